@@ -64,6 +64,74 @@ static void API_queryRenderedFeaturesLayerFromHighDensity(::benchmark::State& st
     }
 }
 
+static void API_queryRenderedFeaturesAllIDsOnly(::benchmark::State& state) {
+    QueryBenchmark bench;
+    RenderedQueryOptions options;
+    options.properties = std::vector<std::string>();
+    options.geometry = false;
+
+    while (state.KeepRunning()) {
+        bench.frontend.getRenderer()->queryRenderedFeatures(bench.box, options);
+    }
+}
+
+static void API_queryRenderedFeaturesStreamAll(::benchmark::State& state) {
+    QueryBenchmark bench;
+
+    while (state.KeepRunning()) {
+        std::size_t count = 0;
+        bench.frontend.getRenderer()->queryRenderedFeatures(bench.box, {}, [&] (const std::string&, Feature&&) {
+            count++;
+            return true;
+        });
+        ::benchmark::DoNotOptimize(count);
+    }
+}
+
+static void API_queryRenderedFeaturesStreamFirst(::benchmark::State& state) {
+    QueryBenchmark bench;
+
+    while (state.KeepRunning()) {
+        bench.frontend.getRenderer()->queryRenderedFeatures(bench.box, {{{ "road-street" }}, {}}, [] (const std::string&, Feature&&) {
+            return false;
+        });
+    }
+}
+
+static void API_querySourceFeatures(::benchmark::State& state) {
+    QueryBenchmark bench;
+
+    while (state.KeepRunning()) {
+        bench.frontend.getRenderer()->querySourceFeatures("composite", {{{ "road", "poi_label" }}, {}});
+    }
+}
+
+static void API_querySourceFeaturesBounds(::benchmark::State& state) {
+    QueryBenchmark bench;
+    SourceQueryOptions options {{{ "road", "poi_label" }}, {}};
+    options.bounds = bench.map.latLngBoundsForCamera(bench.map.getCameraOptions({}));
+
+    while (state.KeepRunning()) {
+        bench.frontend.getRenderer()->querySourceFeatures("composite", options);
+    }
+}
+
+static void API_querySourceFeaturesLimit(::benchmark::State& state) {
+    QueryBenchmark bench;
+    SourceQueryOptions options {{{ "road", "poi_label" }}, {}};
+    options.limit = 100;
+
+    while (state.KeepRunning()) {
+        bench.frontend.getRenderer()->querySourceFeatures("composite", options);
+    }
+}
+
 BENCHMARK(API_queryRenderedFeaturesAll);
+BENCHMARK(API_queryRenderedFeaturesAllIDsOnly);
+BENCHMARK(API_queryRenderedFeaturesStreamAll);
+BENCHMARK(API_queryRenderedFeaturesStreamFirst);
 BENCHMARK(API_queryRenderedFeaturesLayerFromLowDensity);
 BENCHMARK(API_queryRenderedFeaturesLayerFromHighDensity);
+BENCHMARK(API_querySourceFeatures);
+BENCHMARK(API_querySourceFeaturesBounds);
+BENCHMARK(API_querySourceFeaturesLimit);
@@ -29,6 +29,21 @@ public:
     ThreadPool threadPool { 4 };
 };
     
+// Stops the run loop once the first frame with all tiles loaded has been rendered.
+class FullFrameObserver : public MapObserver {
+public:
+    FullFrameObserver(util::RunLoop& loop_) : loop(loop_) {}
+
+    void onDidFinishRenderingMap(RenderMode mode) override {
+        if (mode == RenderMode::Full) {
+            loop.stop();
+        }
+    }
+
+private:
+    util::RunLoop& loop;
+};
+
 static void prepare(Map& map, optional<std::string> json = {}) {
     map.getStyle().loadJSON(json ? *json : util::read_file("benchmark/fixtures/api/style.json"));
     map.setLatLngZoom({ 40.726989, -73.992857 }, 15); // Manhattan
@@ -49,6 +64,33 @@ static void API_renderStill_reuse_map(::benchmark::State& state) {
     }
 }
 
+static void API_renderStill_pan(::benchmark::State& state) {
+    RenderBenchmark bench;
+    HeadlessFrontend frontend { { 1000, 1000 }, 1, bench.fileSource, bench.threadPool };
+    Map map { frontend, MapObserver::nullObserver(), frontend.getSize(), 1, bench.fileSource, bench.threadPool, MapMode::Still };
+    prepare(map);
+
+    // Pans back and forth so that only the camera changes between frames.
+    double direction = 1;
+    while (state.KeepRunning()) {
+        map.moveBy({ 50 * direction, 0 });
+        frontend.render(map);
+        direction = -direction;
+    }
+}
+
+static void API_renderStill_pitched(::benchmark::State& state) {
+    RenderBenchmark bench;
+    HeadlessFrontend frontend { { 1000, 1000 }, 1, bench.fileSource, bench.threadPool };
+    Map map { frontend, MapObserver::nullObserver(), frontend.getSize(), 1, bench.fileSource, bench.threadPool, MapMode::Still };
+    prepare(map);
+    map.setPitch(60);
+
+    while (state.KeepRunning()) {
+        frontend.render(map);
+    }
+}
+
 static void API_renderStill_reuse_map_switch_styles(::benchmark::State& state) {
     RenderBenchmark bench;
     HeadlessFrontend frontend { { 1000, 1000 }, 1, bench.fileSource, bench.threadPool };
@@ -73,6 +115,44 @@ static void API_renderStill_recreate_map(::benchmark::State& state) {
     }
 }
 
+static void API_renderStill_recreate_map_layout_cache(::benchmark::State& state) {
+    RenderBenchmark bench;
+    const std::string layoutCacheDir = "benchmark/fixtures/api/layout_cache";
+
+    // Warm the layout cache, so that every iteration measures a cold start with cached layouts.
+    {
+        HeadlessFrontend frontend { { 1000, 1000 }, 1, bench.fileSource, bench.threadPool, layoutCacheDir };
+        Map map { frontend, MapObserver::nullObserver(), frontend.getSize(), 1, bench.fileSource, bench.threadPool, MapMode::Still };
+        prepare(map);
+        frontend.render(map);
+    }
+
+    while (state.KeepRunning()) {
+        HeadlessFrontend frontend { { 1000, 1000 }, 1, bench.fileSource, bench.threadPool, layoutCacheDir };
+        Map map { frontend, MapObserver::nullObserver(), frontend.getSize(), 1, bench.fileSource, bench.threadPool, MapMode::Still };
+        prepare(map);
+        frontend.render(map);
+    }
+}
+
+// Time from creating the map to its first complete frame in continuous mode, where programs are
+// prepared ahead of time after each frame.
+static void API_renderContinuous_first_full_frame(::benchmark::State& state) {
+    RenderBenchmark bench;
+
+    while (state.KeepRunning()) {
+        HeadlessFrontend frontend { { 1000, 1000 }, 1, bench.fileSource, bench.threadPool };
+        FullFrameObserver observer { bench.loop };
+        Map map { frontend, observer, frontend.getSize(), 1, bench.fileSource, bench.threadPool, MapMode::Continuous };
+        prepare(map);
+        bench.loop.run();
+    }
+}
+
 BENCHMARK(API_renderStill_reuse_map);
+BENCHMARK(API_renderStill_pan);
+BENCHMARK(API_renderStill_pitched);
 BENCHMARK(API_renderStill_reuse_map_switch_styles);
 BENCHMARK(API_renderStill_recreate_map);
+BENCHMARK(API_renderStill_recreate_map_layout_cache);
+BENCHMARK(API_renderContinuous_first_full_frame);
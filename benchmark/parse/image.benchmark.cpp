@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/util/image_decoder.hpp>
+#include <mbgl/util/io.hpp>
+
+using namespace mbgl;
+
+static void decode(benchmark::State& state, const std::string& path, const ImageDecodeOptions& options) {
+    const std::string data = util::read_file(path);
+
+    while (state.KeepRunning()) {
+        PremultipliedImage image = decodeImage(data, options);
+        if (options.pool) {
+            options.pool->recycle(std::move(image));
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+static void Parse_DecodePNG(benchmark::State& state) {
+    decode(state, "test/fixtures/image/tile.png", {});
+}
+
+static void Parse_DecodePNGPooled(benchmark::State& state) {
+    ImageBufferPool pool { 1024 * 1024 };
+    ImageDecodeOptions options;
+    options.pool = &pool;
+    decode(state, "test/fixtures/image/tile.png", options);
+}
+
+static void Parse_DecodeJPEG(benchmark::State& state) {
+    decode(state, "test/fixtures/image/tile.jpeg", {});
+}
+
+static void Parse_DecodeJPEGPooled(benchmark::State& state) {
+    ImageBufferPool pool { 1024 * 1024 };
+    ImageDecodeOptions options;
+    options.pool = &pool;
+    decode(state, "test/fixtures/image/tile.jpeg", options);
+}
+
+static void Parse_DecodeJPEGScaled(benchmark::State& state) {
+    ImageDecodeOptions options;
+    options.targetSize = Size { 128, 128 };
+    decode(state, "test/fixtures/image/tile.jpeg", options);
+}
+
+BENCHMARK(Parse_DecodePNG);
+BENCHMARK(Parse_DecodePNGPooled);
+BENCHMARK(Parse_DecodeJPEG);
+BENCHMARK(Parse_DecodeJPEGPooled);
+BENCHMARK(Parse_DecodeJPEGScaled);
+
+#if !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
+static void Parse_DecodeWebP(benchmark::State& state) {
+    decode(state, "test/fixtures/image/tile.webp", {});
+}
+
+static void Parse_DecodeWebPPooled(benchmark::State& state) {
+    ImageBufferPool pool { 1024 * 1024 };
+    ImageDecodeOptions options;
+    options.pool = &pool;
+    decode(state, "test/fixtures/image/tile.webp", options);
+}
+
+BENCHMARK(Parse_DecodeWebP);
+BENCHMARK(Parse_DecodeWebPPooled);
+#endif // !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
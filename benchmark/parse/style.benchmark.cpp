@@ -0,0 +1,28 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/style/parser.hpp>
+#include <mbgl/util/io.hpp>
+
+using namespace mbgl;
+
+static void Parse_Style(benchmark::State& state) {
+    const std::string json = util::read_file("benchmark/fixtures/api/style.json");
+
+    while (state.KeepRunning()) {
+        style::Parser parser;
+        parser.parse(json);
+    }
+}
+
+static void Parse_Style_DeferLayers(benchmark::State& state) {
+    const std::string json = util::read_file("benchmark/fixtures/api/style.json");
+
+    while (state.KeepRunning()) {
+        style::Parser parser;
+        parser.deferLayers = true;
+        parser.parse(json);
+    }
+}
+
+BENCHMARK(Parse_Style);
+BENCHMARK(Parse_Style_DeferLayers);
@@ -0,0 +1,68 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/renderer/buckets/fill_bucket.hpp>
+#include <mbgl/geometry/polygon_tessellator.hpp>
+#include <mbgl/renderer/bucket_parameters.hpp>
+#include <mbgl/tile/vector_tile_data.hpp>
+#include <mbgl/util/io.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+class PolygonFeatures {
+public:
+    PolygonFeatures() {
+        VectorTileData tile(std::make_shared<std::string>(util::read_file("test/fixtures/api/assets/streets/10-163-395.vector.pbf")));
+        for (const auto& name : tile.layerNames()) {
+            if (auto layer = tile.getLayer(name)) {
+                for (std::size_t i = 0; i < layer->featureCount(); i++) {
+                    auto feature = layer->getFeature(i);
+                    if (feature->getType() == FeatureType::Polygon) {
+                        geometries.push_back(feature->getGeometries());
+                        features.push_back(std::move(feature));
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<GeometryTileFeature>> features;
+    std::vector<GeometryCollection> geometries;
+};
+
+} // namespace
+
+static void Tessellate_FillBucket(benchmark::State& state) {
+    const PolygonFeatures polygons;
+
+    while (state.KeepRunning()) {
+        FillBucket bucket { { { 10, 163, 395 }, MapMode::Still, 1.0 }, {} };
+        for (std::size_t i = 0; i < polygons.features.size(); i++) {
+            bucket.addFeature(*polygons.features[i], polygons.geometries[i]);
+        }
+        benchmark::DoNotOptimize(bucket.triangles.indexSize());
+    }
+}
+
+static void Tessellate_PolygonTessellator(benchmark::State& state) {
+    const PolygonFeatures polygons;
+    std::vector<GeometryCollection> rings;
+    for (const auto& geometry : polygons.geometries) {
+        for (auto& polygon : classifyRings(geometry)) {
+            rings.push_back(std::move(polygon));
+        }
+    }
+
+    PolygonTessellator tessellator;
+    while (state.KeepRunning()) {
+        std::size_t triangles = 0;
+        for (const auto& polygon : rings) {
+            triangles += tessellator.tessellate(polygon).size() / 3;
+        }
+        benchmark::DoNotOptimize(triangles);
+    }
+}
+
+BENCHMARK(Tessellate_FillBucket);
+BENCHMARK(Tessellate_PolygonTessellator);
@@ -0,0 +1,113 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/offline_database.hpp>
+#include <mbgl/storage/resource.hpp>
+#include <mbgl/storage/response.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+
+#include <atomic>
+#include <thread>
+
+using namespace mbgl;
+
+namespace {
+
+const std::string cachePath = "benchmark/fixtures/api/cache_hit.db";
+const std::string urlTemplate =
+    "mapbox://tiles/mapbox.mapbox-terrain-v2,mapbox.mapbox-streets-v7/{z}/{x}/{y}.vector.pbf";
+
+// Writes tiles of an offline region through a separate connection until stopped, like an
+// OfflineDownload does on the file source's database thread.
+class OfflineDownloadSimulation {
+public:
+    OfflineDownloadSimulation() : thread([this] { run(); }) {}
+
+    ~OfflineDownloadSimulation() {
+        stopped = true;
+        thread.join();
+    }
+
+private:
+    void run() {
+        OfflineDatabase db(cachePath);
+        OfflineRegionDefinition definition { "http://example.com/style",
+                                             LatLngBounds::hull({ 1, 2 }, { 3, 4 }), 5, 6, 2.0 };
+        OfflineRegion region = db.createRegion(definition, {});
+
+        Response response;
+        response.data = std::make_shared<std::string>(32 * 1024, 'x');
+
+        for (int32_t x = 0; !stopped; x++) {
+            db.putRegionResource(region.getID(),
+                                 Resource::tile("http://example.com/{z}/{x}/{y}.pbf", 1, x, 0, 16,
+                                                Tileset::Scheme::XYZ),
+                                 response);
+        }
+    }
+
+    std::atomic<bool> stopped { false };
+    std::thread thread;
+};
+
+} // namespace
+
+// Measures the latency of cache hits, with range_x() = 1 while an offline region is being
+// downloaded into the same database.
+static void Storage_CacheHitLatency(benchmark::State& state) {
+    util::write_file(cachePath, util::read_file("benchmark/fixtures/api/cache.db"));
+
+    {
+        util::RunLoop loop;
+        DefaultFileSource fileSource(cachePath, ".");
+        std::unique_ptr<OfflineDownloadSimulation> download;
+        if (state.range_x()) {
+            download = std::make_unique<OfflineDownloadSimulation>();
+        }
+
+        int32_t i = 0;
+        while (state.KeepRunning()) {
+            const Resource tile = Resource::tile(urlTemplate, 1, 9646 + i % 6, 12316 + i % 5, 15,
+                                                 Tileset::Scheme::XYZ, Resource::Optional);
+            i++;
+
+            std::unique_ptr<AsyncRequest> request = fileSource.request(tile, [&](Response res) {
+                benchmark::DoNotOptimize(res.data);
+                loop.stop();
+            });
+            loop.run();
+        }
+    }
+
+    util::deleteFile(cachePath);
+}
+
+BENCHMARK(Storage_CacheHitLatency)->Arg(0)->Arg(1);
+
+// Measures how many cached tiles the database thread can serve, including recording their
+// access times for eviction.
+static void Storage_CacheReadThroughput(benchmark::State& state) {
+    util::write_file(cachePath, util::read_file("benchmark/fixtures/api/cache.db"));
+
+    {
+        OfflineDatabase db(cachePath);
+
+        int32_t i = 0;
+        while (state.KeepRunning()) {
+            const Resource tile = Resource::tile(urlTemplate, 1, 9646 + i % 6, 12316 + i % 5, 15,
+                                                 Tileset::Scheme::XYZ);
+            i++;
+
+            auto response = db.get(tile);
+            db.markAccessed(tile);
+            benchmark::DoNotOptimize(response);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    util::deleteFile(cachePath);
+}
+
+BENCHMARK(Storage_CacheReadThroughput);
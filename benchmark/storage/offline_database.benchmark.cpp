@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/storage/offline_database.hpp>
+#include <mbgl/storage/resource.hpp>
+#include <mbgl/storage/response.hpp>
+#include <mbgl/util/io.hpp>
+
+#include <sqlite3.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+const std::string databasePath = "benchmark/fixtures/api/eviction.db";
+const std::string urlTemplate = "http://example.com/{z}/{x}/{y}.pbf";
+
+// Creates a database with a million tiles: 900,000 small ones used by an offline region, and
+// 100,000 ambient ones that take up more than the default maximum cache size.
+void createDatabase() {
+    try {
+        util::deleteFile(databasePath);
+    } catch (util::IOException&) {
+    }
+
+    {
+        OfflineDatabase db(databasePath);
+        db.createRegion({ urlTemplate, LatLngBounds::world(), 0, 20, 1.0 }, {});
+    }
+
+    mapbox::sqlite::Database db(databasePath, mapbox::sqlite::ReadWrite);
+    db.exec("BEGIN");
+    db.exec("WITH RECURSIVE n(i) AS (SELECT 0 UNION ALL SELECT i + 1 FROM n WHERE i < 999999) "
+            "INSERT INTO tiles (url_template, pixel_ratio, z, x, y, data, accessed, region_owned) "
+            "SELECT '" + urlTemplate + "', 1, 20, i % 1024, i / 1024, "
+            "       randomblob(CASE WHEN i < 900000 THEN 16 ELSE 600 END), i, i < 900000 "
+            "FROM n");
+    db.exec("INSERT INTO region_tiles (region_id, tile_id) "
+            "SELECT 1, id FROM tiles WHERE region_owned = 1");
+    db.exec("COMMIT");
+}
+
+Resource newTile(int32_t i) {
+    return Resource::tile(urlTemplate, 1, i, 0, 21, Tileset::Scheme::XYZ);
+}
+
+} // namespace
+
+// Measures ambient puts into a full cache, which doesn't evict in put().
+static void Storage_AmbientCachePut(benchmark::State& state) {
+    createDatabase();
+
+    {
+        OfflineDatabase db(databasePath);
+        Response response;
+        response.data = std::make_shared<std::string>(16 * 1024, 'x');
+
+        // Calculates the ambient cache size up front, like the file source does after each put.
+        benchmark::DoNotOptimize(db.needsEviction());
+
+        int32_t i = 0;
+        while (state.KeepRunning()) {
+            db.put(newTile(i++), response);
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    util::deleteFile(databasePath);
+}
+
+// Measures evicting a tenth of the cache from a database where most tiles belong to a region.
+static void Storage_AmbientCacheEvict(benchmark::State& state) {
+    createDatabase();
+
+    {
+        OfflineDatabase db(databasePath);
+        Response response;
+        response.data = std::make_shared<std::string>(64 * 1024, 'x');
+
+        int32_t i = 0;
+        while (state.KeepRunning()) {
+            state.PauseTiming();
+            while (!db.needsEviction()) {
+                db.put(newTile(i++), response);
+            }
+            state.ResumeTiming();
+
+            db.evict();
+        }
+    }
+
+    util::deleteFile(databasePath);
+}
+
+BENCHMARK(Storage_AmbientCachePut);
+BENCHMARK(Storage_AmbientCacheEvict);
@@ -0,0 +1,70 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/text/bidi.hpp>
+#include <mbgl/text/glyph.hpp>
+#include <mbgl/text/shaping.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+// Labels long enough to wrap at a text-max-width of 10 ems.
+const std::vector<std::u16string> labels = {
+    u"Metropolitan Museum of Art Costume Institute",
+    u"Brooklyn Bridge Park Pier 6 Playground and Beach Volleyball Courts",
+    u"John F. Kennedy International Airport Terminal 4 (Arrivals)",
+    u"Avenue of the Americas / Sixth Avenue and West 42nd Street",
+    u"東京都庁第一本庁舎展望室",
+    u"新宿御苑国民公園大木戸門",
+    u"北京市海淀区中关村大街二十七号",
+    u"大阪市立美術館天王寺公園",
+};
+
+Glyphs makeGlyphs() {
+    Glyphs glyphs;
+    for (const auto& label : labels) {
+        for (char16_t chr : label) {
+            Glyph glyph;
+            glyph.id = chr;
+            glyph.metrics.advance = chr > 0x2E80 ? 24 : 8 + chr % 6;
+            glyphs.emplace(chr, makeMutable<Glyph>(std::move(glyph)));
+        }
+    }
+    return glyphs;
+}
+
+} // namespace
+
+static void Text_DetermineLineBreaks(benchmark::State& state) {
+    const Glyphs glyphs = makeGlyphs();
+    ShapingBuffers buffers;
+
+    while (state.KeepRunning()) {
+        for (const auto& label : labels) {
+            determineLineBreaks(label, 0, 240, WritingModeType::Horizontal, glyphs, buffers);
+            benchmark::DoNotOptimize(buffers.lineBreaks.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * labels.size());
+}
+
+static void Text_ShapeMultilineLabels(benchmark::State& state) {
+    const Glyphs glyphs = makeGlyphs();
+    BiDi bidi;
+    ShapingBuffers buffers;
+
+    while (state.KeepRunning()) {
+        for (const auto& label : labels) {
+            benchmark::DoNotOptimize(getShaping(label, 240, 28.8, TextAnchorType::Center,
+                                                TextJustifyType::Center, 0, { 0, 0 }, 24,
+                                                WritingModeType::Horizontal, bidi, buffers, glyphs));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * labels.size());
+}
+
+BENCHMARK(Text_DetermineLineBreaks);
+BENCHMARK(Text_ShapeMultilineLabels);
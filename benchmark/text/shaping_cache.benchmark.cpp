@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/text/bidi.hpp>
+#include <mbgl/text/glyph.hpp>
+#include <mbgl/text/shaping_cache.hpp>
+#include <mbgl/util/string.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+// Street and place names as they repeat across neighbouring tiles and zoom levels.
+const std::vector<std::u16string> labels = {
+    u"Broadway", u"Avenue of the Americas", u"West Houston Street", u"Bleecker Street",
+    u"Lafayette Street", u"Canal Street", u"Bowery", u"East 14th Street", u"Union Square",
+    u"Washington Square Park", u"Greenwich Village", u"Little Italy", u"Chinatown",
+    u"Delancey Street", u"Second Avenue", u"Christopher Street", u"Hudson Street",
+    u"West Broadway", u"Prince Street", u"Spring Street",
+};
+
+const FontStack fontStack { "Open Sans Regular", "Arial Unicode MS Regular" };
+
+Glyphs makeGlyphs() {
+    Glyphs glyphs;
+    for (const auto& label : labels) {
+        for (char16_t chr : label) {
+            Glyph glyph;
+            glyph.id = chr;
+            glyph.metrics.advance = 8 + chr % 6;
+            glyphs.emplace(chr, makeMutable<Glyph>(std::move(glyph)));
+        }
+    }
+    return glyphs;
+}
+
+// Lays out every label once for each of `tiles` tiles.
+template <class Shape>
+void layoutTiles(std::size_t tiles, Shape&& shape) {
+    for (std::size_t tile = 0; tile < tiles; tile++) {
+        for (const auto& label : labels) {
+            benchmark::DoNotOptimize(shape(label));
+        }
+    }
+}
+
+} // namespace
+
+static void Text_ShapeLabels(benchmark::State& state) {
+    BiDi bidi;
+    ShapingBuffers buffers;
+    const Glyphs glyphs = makeGlyphs();
+
+    while (state.KeepRunning()) {
+        layoutTiles(state.range_x(), [&] (const std::u16string& label) {
+            return getShaping(label, 240, 28.8, TextAnchorType::Center, TextJustifyType::Center, 0,
+                              { 0, 0 }, 24, WritingModeType::Horizontal, bidi, buffers, glyphs);
+        });
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range_x() * labels.size());
+}
+
+static void Text_ShapeLabelsCached(benchmark::State& state) {
+    BiDi bidi;
+    ShapingBuffers buffers;
+    const Glyphs glyphs = makeGlyphs();
+    ShapingCache cache;
+
+    while (state.KeepRunning()) {
+        layoutTiles(state.range_x(), [&] (const std::u16string& label) {
+            return cache.get(label, fontStack, 240, 28.8, TextAnchorType::Center,
+                             TextJustifyType::Center, 0, { 0, 0 }, 24,
+                             WritingModeType::Horizontal, bidi, buffers, glyphs);
+        });
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range_x() * labels.size());
+    const uint64_t lookups = cache.hits() + cache.misses();
+    state.SetLabel("hit rate " + util::toString(lookups ? cache.hits() * 100 / lookups : 0) + "%");
+}
+
+BENCHMARK(Text_ShapeLabels)->Arg(1)->Arg(16)->Arg(64);
+BENCHMARK(Text_ShapeLabelsCached)->Arg(1)->Arg(16)->Arg(64);
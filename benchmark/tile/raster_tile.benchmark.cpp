@@ -0,0 +1,93 @@
+#include <benchmark/benchmark.h>
+
+#include <mbgl/tile/raster_tile.hpp>
+#include <mbgl/tile/tile_observer.hpp>
+#include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/map/transform_state.hpp>
+#include <mbgl/annotation/annotation_manager.hpp>
+#include <mbgl/storage/file_source.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/tileset.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+// Doesn't support optional requests, so tiles don't request their data and only get the data
+// that is set explicitly.
+class NullFileSource : public FileSource {
+public:
+    std::unique_ptr<AsyncRequest> request(const Resource&, Callback) override {
+        return nullptr;
+    }
+};
+
+// Stops the run loop once the tile has been parsed.
+class ParsedObserver : public TileObserver {
+public:
+    ParsedObserver(util::RunLoop& loop_) : loop(loop_) {}
+
+    void onTileChanged(Tile&) override {
+        loop.stop();
+    }
+
+    void onTileError(Tile&, std::exception_ptr) override {
+        loop.stop();
+    }
+
+private:
+    util::RunLoop& loop;
+};
+
+} // namespace
+
+// Measures reviving a cached raster tile: compact() drops the decoded image, and revive()
+// decodes it again from the encoded data the tile kept.
+static void Tile_RasterRevive(benchmark::State& state) {
+    util::RunLoop loop;
+    NullFileSource fileSource;
+    TransformState transformState;
+    ThreadPool threadPool { 1 };
+    style::Style style { loop, fileSource, 1 };
+    AnnotationManager annotationManager { style };
+    ImageManager imageManager;
+    GlyphManager glyphManager { fileSource };
+    Tileset tileset { { "https://example.com" }, { 0, 22 }, "none" };
+
+    TileParameters parameters {
+        1.0,
+        MapDebugOptions(),
+        transformState,
+        threadPool,
+        fileSource,
+        MapMode::Continuous,
+        annotationManager,
+        imageManager,
+        glyphManager,
+        0,
+        nullptr
+    };
+
+    const auto data = std::make_shared<const std::string>(util::read_file("test/fixtures/image/tile.png"));
+
+    ParsedObserver observer { loop };
+    RasterTile tile(OverscaledTileID(0, 0, 0), parameters, tileset, 256);
+    tile.setObserver(&observer);
+    tile.setData(data, {}, {});
+    loop.run();
+
+    while (state.KeepRunning()) {
+        tile.compact();
+        tile.revive();
+        loop.run();
+    }
+
+    state.SetBytesProcessed(state.iterations() * data->size());
+}
+
+BENCHMARK(Tile_RasterRevive);
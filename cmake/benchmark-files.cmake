@@ -10,15 +10,31 @@ set(MBGL_BENCHMARK_FILES
 
     # parse
     benchmark/parse/filter.benchmark.cpp
+    benchmark/parse/image.benchmark.cpp
+    benchmark/parse/style.benchmark.cpp
     benchmark/parse/tile_mask.benchmark.cpp
     benchmark/parse/vector_tile.benchmark.cpp
 
+    # renderer
+    benchmark/renderer/fill_bucket.benchmark.cpp
+
     # src
     benchmark/src/main.cpp
 
     # src/mbgl/benchmark
     benchmark/src/mbgl/benchmark/benchmark.cpp
 
+    # storage
+    benchmark/storage/default_file_source.benchmark.cpp
+    benchmark/storage/offline_database.benchmark.cpp
+
+    # text
+    benchmark/text/shaping.benchmark.cpp
+    benchmark/text/shaping_cache.benchmark.cpp
+
+    # tile
+    benchmark/tile/raster_tile.benchmark.cpp
+
     # util
     benchmark/util/dtoa.benchmark.cpp
 )
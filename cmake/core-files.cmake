@@ -48,6 +48,8 @@ set(MBGL_CORE_FILES
     src/mbgl/geometry/feature_index.hpp
     src/mbgl/geometry/line_atlas.cpp
     src/mbgl/geometry/line_atlas.hpp
+    src/mbgl/geometry/polygon_tessellator.cpp
+    src/mbgl/geometry/polygon_tessellator.hpp
 
     # gl
     src/mbgl/gl/attribute.cpp
@@ -157,6 +159,7 @@ set(MBGL_CORE_FILES
 
     # renderer
     include/mbgl/renderer/backend_scope.hpp
+    include/mbgl/renderer/frame_stats.hpp
     include/mbgl/renderer/query.hpp
     include/mbgl/renderer/renderer.hpp
     include/mbgl/renderer/renderer_backend.hpp
@@ -204,6 +207,8 @@ set(MBGL_CORE_FILES
     src/mbgl/renderer/renderer_impl.cpp
     src/mbgl/renderer/renderer_impl.hpp
     src/mbgl/renderer/renderer_observer.hpp
+    src/mbgl/renderer/source_feature_query.cpp
+    src/mbgl/renderer/source_feature_query.hpp
     src/mbgl/renderer/style_diff.cpp
     src/mbgl/renderer/style_diff.hpp
     src/mbgl/renderer/tile_mask.hpp
@@ -214,6 +219,7 @@ set(MBGL_CORE_FILES
     src/mbgl/renderer/update_parameters.hpp
 
     # renderer/buckets
+    src/mbgl/renderer/buckets/bucket_serialization.hpp
     src/mbgl/renderer/buckets/circle_bucket.cpp
     src/mbgl/renderer/buckets/circle_bucket.hpp
     src/mbgl/renderer/buckets/debug_bucket.cpp
@@ -493,6 +499,8 @@ set(MBGL_CORE_FILES
     src/mbgl/text/quads.hpp
     src/mbgl/text/shaping.cpp
     src/mbgl/text/shaping.hpp
+    src/mbgl/text/shaping_cache.cpp
+    src/mbgl/text/shaping_cache.hpp
 
     # tile
     src/mbgl/tile/geojson_tile.cpp
@@ -503,6 +511,8 @@ set(MBGL_CORE_FILES
     src/mbgl/tile/geometry_tile_data.hpp
     src/mbgl/tile/geometry_tile_worker.cpp
     src/mbgl/tile/geometry_tile_worker.hpp
+    src/mbgl/tile/layout_cache.cpp
+    src/mbgl/tile/layout_cache.hpp
     src/mbgl/tile/raster_tile.cpp
     src/mbgl/tile/raster_tile.hpp
     src/mbgl/tile/raster_tile_worker.cpp
@@ -574,6 +584,7 @@ set(MBGL_CORE_FILES
     src/mbgl/util/dtoa.cpp
     src/mbgl/util/dtoa.hpp
     src/mbgl/util/event.cpp
+    src/mbgl/util/fnv_hash.hpp
     src/mbgl/util/font_stack.cpp
     src/mbgl/util/geo.cpp
     src/mbgl/util/geojson_impl.cpp
@@ -585,6 +596,9 @@ set(MBGL_CORE_FILES
     src/mbgl/util/http_timeout.hpp
     src/mbgl/util/i18n.cpp
     src/mbgl/util/i18n.hpp
+    src/mbgl/util/image_buffer_pool.cpp
+    src/mbgl/util/image_buffer_pool.hpp
+    src/mbgl/util/image_decoder.hpp
     src/mbgl/util/interpolate.cpp
     src/mbgl/util/intersection_tests.cpp
     src/mbgl/util/intersection_tests.hpp
@@ -603,6 +617,8 @@ set(MBGL_CORE_FILES
     src/mbgl/util/math.hpp
     src/mbgl/util/offscreen_texture.cpp
     src/mbgl/util/offscreen_texture.hpp
+    src/mbgl/util/parallel.cpp
+    src/mbgl/util/parallel.hpp
     src/mbgl/util/premultiply.cpp
     src/mbgl/util/rapidjson.hpp
     src/mbgl/util/rect.hpp
@@ -19,6 +19,9 @@ set(MBGL_TEST_FILES
     test/api/query.test.cpp
     test/api/recycle_map.cpp
 
+    # geometry
+    test/geometry/polygon_tessellator.test.cpp
+
     # gl
     test/gl/bucket.test.cpp
     test/gl/object.test.cpp
@@ -44,6 +47,10 @@ set(MBGL_TEST_FILES
     test/renderer/backend_scope.test.cpp
     test/renderer/group_by_layout.test.cpp
     test/renderer/image_manager.test.cpp
+    test/renderer/paint_property_binder.test.cpp
+    test/renderer/render_tile.test.cpp
+    test/renderer/source_feature_query.test.cpp
+    test/renderer/tile_pyramid.test.cpp
 
     # sprite
     test/sprite/sprite_loader.test.cpp
@@ -78,6 +85,7 @@ set(MBGL_TEST_FILES
     test/storage/offline_download.test.cpp
     test/storage/online_file_source.test.cpp
     test/storage/resource.test.cpp
+    test/storage/response_cache.test.cpp
     test/storage/sqlite.test.cpp
 
     # style/conversion
@@ -109,11 +117,14 @@ set(MBGL_TEST_FILES
     test/text/glyph_loader.test.cpp
     test/text/glyph_pbf.test.cpp
     test/text/quads.test.cpp
+    test/text/shaping.test.cpp
+    test/text/shaping_cache.test.cpp
 
     # tile
     test/tile/annotation_tile.test.cpp
     test/tile/geojson_tile.test.cpp
     test/tile/geometry_tile_data.test.cpp
+    test/tile/layout_cache.test.cpp
     test/tile/raster_tile.test.cpp
     test/tile/tile_coordinate.test.cpp
     test/tile/tile_id.test.cpp
@@ -122,6 +133,7 @@ set(MBGL_TEST_FILES
     # util
     test/util/async_task.test.cpp
     test/util/dtoa.test.cpp
+    test/util/fnv_hash.test.cpp
     test/util/geo.test.cpp
     test/util/http_timeout.test.cpp
     test/util/image.test.cpp
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <mbgl/util/chrono.hpp>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+namespace mbgl {
+
+// Describes the work that went into rendering a frame.
+class FrameStats {
+public:
+    // Draw calls issued, programs bound, and the vertices and indices they referenced.
+    std::size_t drawCalls = 0;
+    std::size_t programBinds = 0;
+    std::size_t vertices = 0;
+    std::size_t indices = 0;
+
+    // Bytes uploaded to textures and to vertex and index buffers.
+    std::size_t textureBytes = 0;
+    std::size_t bufferBytes = 0;
+
+    // OpenGL objects deleted at the end of the frame, e.g. those of tiles that were evicted.
+    std::size_t deletedObjects = 0;
+
+    // Number of tiles rendered, keyed by source ID.
+    std::unordered_map<std::string, std::size_t> tiles;
+
+    // Number of those tiles that were outside of the viewport or covered no pixel center on screen,
+    // and were skipped by layers clipped to tile bounds.
+    std::size_t culledTiles = 0;
+
+    // Number of clipping masks drawn to the stencil buffer. This is zero when the tiles didn't
+    // overlap and were clipped with scissor rectangles instead.
+    std::size_t clippingMasks = 0;
+
+    // CPU time spent in each render pass.
+    Duration uploadTime = Duration::zero();
+    Duration clipTime = Duration::zero();
+    Duration opaqueTime = Duration::zero();
+    Duration translucentTime = Duration::zero();
+};
+
+} // namespace mbgl
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <mbgl/util/optional.hpp>
+#include <mbgl/util/feature.hpp>
+#include <mbgl/util/geo.hpp>
 #include <mbgl/style/filter.hpp>
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -22,8 +25,23 @@ public:
     optional<std::vector<std::string>> layerIDs;
 
     optional<style::Filter> filter;
+
+    /**
+     * Names of the properties to copy into the resulting features. If empty,
+     * features carry only their id and geometry. All properties are copied if unset.
+     */
+    optional<std::vector<std::string>> properties;
+
+    /** Whether to convert the features' geometries. Without it, features carry an empty point. */
+    bool geometry = true;
 };
 
+/**
+ * Receives the features of a streamed query for rendered features, along with the
+ * ID of the layer each was rendered in. Returning false stops the query.
+ */
+using RenderedFeatureCallback = std::function<bool (const std::string& layerID, Feature&&)>;
+
 /**
  * Options for query source features
  */
@@ -38,6 +56,12 @@ public:
     optional<std::vector<std::string>> sourceLayers;
 
     optional<style::Filter> filter;
+
+    /** Only return features whose bounding box intersects these bounds */
+    optional<LatLngBounds> bounds;
+
+    /** Maximum number of features to return */
+    optional<std::size_t> limit;
 };
 
 } // namespace mbgl
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/map/mode.hpp>
+#include <mbgl/renderer/frame_stats.hpp>
 #include <mbgl/renderer/query.hpp>
 #include <mbgl/annotation/annotation.hpp>
 #include <mbgl/util/geo.hpp>
@@ -25,7 +26,8 @@ class Renderer {
 public:
     Renderer(RendererBackend&, float pixelRatio_, FileSource&, Scheduler&,
              GLContextMode = GLContextMode::Unique,
-             const optional<std::string> programCacheDir = {});
+             const optional<std::string> programCacheDir = {},
+             const optional<std::string> layoutCacheDir = {});
     ~Renderer();
 
     void setObserver(RendererObserver*);
@@ -36,12 +38,25 @@ public:
     std::vector<Feature> queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions& options = {}) const;
     std::vector<Feature> queryRenderedFeatures(const ScreenCoordinate& point, const RenderedQueryOptions& options = {}) const;
     std::vector<Feature> queryRenderedFeatures(const ScreenBox& box, const RenderedQueryOptions& options = {}) const;
+
+    // Streams the features to the callback as they're found, until it returns false. Unlike the
+    // queries above, features aren't ordered by layer, and the query stops as soon as the caller
+    // has what it needs.
+    void queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions&, const RenderedFeatureCallback&) const;
+    void queryRenderedFeatures(const ScreenCoordinate& point, const RenderedQueryOptions&, const RenderedFeatureCallback&) const;
+    void queryRenderedFeatures(const ScreenBox& box, const RenderedQueryOptions&, const RenderedFeatureCallback&) const;
+
     std::vector<Feature> querySourceFeatures(const std::string& sourceID, const SourceQueryOptions& options = {}) const;
     AnnotationIDs queryPointAnnotations(const ScreenBox& box) const;
 
     // Debug
     void dumpDebugLogs();
 
+    // Statistics for the most recently rendered frame. These are complete once render() has
+    // returned, and in continuous mode already when RendererObserver::onDidFinishRenderingFrame
+    // is called.
+    FrameStats getFrameStats() const;
+
     // Memory
     void onLowMemory();
 
@@ -6,6 +6,7 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/optional.hpp>
 
+#include <atomic>
 #include <vector>
 #include <mutex>
 
@@ -16,6 +17,7 @@ template <typename T> class Thread;
 } // namespace util
 
 class ResourceTransform;
+class ResponseCache;
 
 class DefaultFileSource : public FileSource {
 public:
@@ -46,8 +48,19 @@ public:
 
     void setResourceTransform(optional<ActorRef<ResourceTransform>>&&);
 
+    // Limits the number of connections opened to a single host. 0 restores the default.
+    void setMaximumConnectionsPerHost(uint32_t);
+
     std::unique_ptr<AsyncRequest> request(const Resource&, Callback) override;
 
+    /*
+     * Recently used responses are kept in memory, shared between all maps using this file
+     * source. These count the lookups that were answered from memory, and those that had to go
+     * to the offline database.
+     */
+    uint64_t getMemoryCacheHits() const;
+    uint64_t getMemoryCacheMisses() const;
+
     /*
      * Retrieve all regions in the offline database.
      *
@@ -143,11 +156,19 @@ public:
     void put(const Resource&, const Response&);
 
     class Impl;
+    class ReadImpl;
 
 private:
     // Shared so destruction is done on this thread
     const std::shared_ptr<FileSource> assetFileSource;
+    const std::shared_ptr<ResponseCache> memoryCache;
     const std::unique_ptr<util::Thread<Impl>> impl;
+    std::vector<std::unique_ptr<util::Thread<ReadImpl>>> readers;
+    std::atomic<std::size_t> nextReader { 0 };
+
+    // Requests are identified by a number that is never reused, rather than by their address, so
+    // that a late cancellation can't affect a newer request allocated at the same address.
+    std::atomic<uint64_t> nextRequestID { 0 };
 
     std::mutex cachedBaseURLMutex;
     std::string cachedBaseURL = mbgl::util::API_BASE_URL;
@@ -22,6 +22,9 @@ public:
 
     void setResourceTransform(optional<ActorRef<ResourceTransform>>&&);
 
+    // Limits the number of connections opened to a single host. 0 restores the default.
+    void setMaximumConnectionsPerHost(uint32_t);
+
     std::unique_ptr<AsyncRequest> request(const Resource&, Callback) override;
 
 private:
@@ -62,6 +62,10 @@ public:
     Necessity necessity;
     std::string url;
 
+    // Among network requests waiting for a connection that have the same necessity, and are
+    // either both tiles or both not, those with a higher priority are made first.
+    int32_t priority = 0;
+
     // Includes auxiliary data if this is a tile request.
     optional<TileData> tileData;
 
@@ -123,10 +123,23 @@ public:
     LayerObserver* observer = nullptr;
     void setObserver(LayerObserver*);
 
+    // Layers whose conversion was deferred while parsing a style only have their ID, type, source
+    // and zoom range, and are hidden. They keep their JSON here until they are converted in place,
+    // either once the map approaches their zoom range or when another property is accessed.
+    mutable std::unique_ptr<const std::string> deferredJSON;
+
+    // Converts a deferred layer in place, and returns false if its JSON fails to convert.
+    bool convertDeferred() const;
+
     // For use in SDK bindings, which store a reference to a platform-native peer
     // object here, so that separately-obtained references to this object share
     // identical platform-native peers.
     any peer;
+
+protected:
+    // Called before properties other than the ID, type and zoom range are accessed. Converts a
+    // deferred layer and notifies the observer.
+    void convertDeferredOnAccess() const;
 };
 
 } // namespace style
@@ -70,6 +70,11 @@ public:
     void addLayer(std::unique_ptr<Layer>, const optional<std::string>& beforeLayerID = {});
     std::unique_ptr<Layer> removeLayer(const std::string& layerID);
 
+    // When enabled, layers with a zoom range are only fully converted once the map approaches
+    // that range or one of their properties is accessed, which speeds up loading large styles.
+    // Applies to styles loaded afterwards.
+    void setDeferredLayerParsing(bool);
+
     // Private implementation
     class Impl;
     const std::unique_ptr<Impl> impl;
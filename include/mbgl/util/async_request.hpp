@@ -2,11 +2,16 @@
 
 #include <mbgl/util/noncopyable.hpp>
 
+#include <cstdint>
+
 namespace mbgl {
 
 class AsyncRequest : private util::noncopyable {
 public:
     virtual ~AsyncRequest() = default;
+
+    // Changes the order in which a request that is still waiting is served; see Resource::priority.
+    virtual void setPriority(int32_t) {}
 };
 
 } // namespace mbgl
@@ -6,6 +6,9 @@ namespace mbgl {
 namespace util {
 
 PremultipliedImage premultiply(UnassociatedImage&&);
+
+// Premultiplies `bytes` bytes of RGBA pixels in place, e.g. a single row while it is decoded.
+void premultiply(uint8_t* data, std::size_t bytes);
 UnassociatedImage unpremultiply(PremultipliedImage&&);
 
 } // namespace util
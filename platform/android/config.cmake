@@ -47,6 +47,8 @@ macro(mbgl_platform_core)
         PRIVATE platform/default/mbgl/storage/offline_database.hpp
         PRIVATE platform/default/mbgl/storage/offline_download.cpp
         PRIVATE platform/default/mbgl/storage/offline_download.hpp
+        PRIVATE platform/default/mbgl/storage/response_cache.cpp
+        PRIVATE platform/default/mbgl/storage/response_cache.hpp
         PRIVATE platform/default/sqlite3.cpp
         PRIVATE platform/default/sqlite3.hpp
 
@@ -192,4 +192,12 @@ uint32_t HTTPFileSource::maximumConcurrentRequests() {
     return 20;
 }
 
+uint32_t HTTPFileSource::multiplexedRequestLimit(const std::string&) const {
+    return 0;
+}
+
+void HTTPFileSource::setMaximumConnectionsPerHost(uint32_t) {
+    // Connections are pooled and limited by the Java HTTP client.
+}
+
 } // namespace mbgl
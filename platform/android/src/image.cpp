@@ -1,4 +1,5 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_decoder.hpp>
 #include <mbgl/util/string.hpp>
 
 #include <string>
@@ -19,4 +20,11 @@ PremultipliedImage decodeImage(const std::string& string) {
     return android::Bitmap::GetImage(*env, bitmap);
 }
 
+PremultipliedImage decodeImage(const std::string& string, const ImageDecodeOptions&) {
+    // BitmapFactory allocates its own buffers and returns premultiplied pixels. The target size is
+    // ignored: images are decoded at full size, since subsampling with BitmapFactory.Options
+    // only supports power-of-two factors and needs a second pass to read the image bounds.
+    return decodeImage(string);
+}
+
 } // namespace mbgl
@@ -79,12 +79,14 @@ private:
 
 class HTTPFileSource::Impl {
 public:
+    static constexpr NSInteger defaultMaximumConnectionsPerHost = 8;
+
     Impl() {
         @autoreleasepool {
             NSURLSessionConfiguration* sessionConfig =
                 [NSURLSessionConfiguration defaultSessionConfiguration];
             sessionConfig.timeoutIntervalForResource = 30;
-            sessionConfig.HTTPMaximumConnectionsPerHost = 8;
+            sessionConfig.HTTPMaximumConnectionsPerHost = defaultMaximumConnectionsPerHost;
             sessionConfig.requestCachePolicy = NSURLRequestReloadIgnoringLocalCacheData;
             sessionConfig.URLCache = nil;
 
@@ -196,6 +198,22 @@ uint32_t HTTPFileSource::maximumConcurrentRequests() {
     return 20;
 }
 
+uint32_t HTTPFileSource::multiplexedRequestLimit(const std::string&) const {
+    return 0;
+}
+
+void HTTPFileSource::setMaximumConnectionsPerHost(uint32_t maximum) {
+    @autoreleasepool {
+        // Session configurations are copied on creation, so replace the session. Tasks that are
+        // already running on the old session are allowed to finish.
+        NSURLSessionConfiguration* sessionConfig = [impl->session.configuration copy];
+        sessionConfig.HTTPMaximumConnectionsPerHost =
+            maximum ? maximum : Impl::defaultMaximumConnectionsPerHost;
+        [impl->session finishTasksAndInvalidate];
+        impl->session = [NSURLSession sessionWithConfiguration:sessionConfig];
+    }
+}
+
 std::unique_ptr<AsyncRequest> HTTPFileSource::request(const Resource& resource, Callback callback) {
     auto request = std::make_unique<HTTPRequest>(callback);
     auto shared = request->shared; // Explicit copy so that it also gets copied into the completion handler block below.
@@ -1,7 +1,12 @@
 #include <mbgl/util/image+MGLAdditions.hpp>
+#include <mbgl/util/image_decoder.hpp>
 
+#import <Foundation/Foundation.h>
 #import <ImageIO/ImageIO.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace {
 
 template <typename T, typename S, void (*Releaser)(S)>
@@ -18,6 +23,7 @@ private:
 
 using CGImageHandle = CFHandle<CGImageRef, CGImageRef, CGImageRelease>;
 using CFDataHandle = CFHandle<CFDataRef, CFTypeRef, CFRelease>;
+using CFDictionaryHandle = CFHandle<CFDictionaryRef, CFTypeRef, CFRelease>;
 using CGImageSourceHandle = CFHandle<CGImageSourceRef, CFTypeRef, CFRelease>;
 using CGDataProviderHandle = CFHandle<CGDataProviderRef, CGDataProviderRef, CGDataProviderRelease>;
 using CGColorSpaceHandle = CFHandle<CGColorSpaceRef, CGColorSpaceRef, CGColorSpaceRelease>;
@@ -84,6 +90,36 @@ mbgl::PremultipliedImage MGLPremultipliedImageFromCGImage(CGImageRef src) {
 namespace mbgl {
 
 PremultipliedImage decodeImage(const std::string& source) {
+    return decodeImage(source, {});
+}
+
+// Returns the longest side of a thumbnail that covers the target size, or 0 if the image isn't
+// larger than the target size.
+static size_t thumbnailSize(CGImageSourceRef imageSource, const optional<Size>& targetSize) {
+    if (!targetSize || targetSize->isEmpty()) {
+        return 0;
+    }
+
+    CFDictionaryHandle properties(CGImageSourceCopyPropertiesAtIndex(imageSource, 0, NULL));
+    if (!properties) {
+        return 0;
+    }
+
+    NSDictionary *dictionary = (__bridge NSDictionary *)*properties;
+    const double width = [dictionary[(__bridge NSString *)kCGImagePropertyPixelWidth] doubleValue];
+    const double height = [dictionary[(__bridge NSString *)kCGImagePropertyPixelHeight] doubleValue];
+    if (width <= targetSize->width || height <= targetSize->height) {
+        return 0;
+    }
+
+    const double scale = std::max(targetSize->width / width, targetSize->height / height);
+    return std::ceil(std::max(width, height) * scale);
+}
+
+PremultipliedImage decodeImage(const std::string& source, const ImageDecodeOptions& options) {
+    // ImageIO allocates its own buffers and premultiplies while drawing, so the pool is unused.
+    // Images larger than the target size are decoded as thumbnails, which lets ImageIO subsample
+    // while decoding.
     CFDataHandle data(CFDataCreateWithBytesNoCopy(
         kCFAllocatorDefault, reinterpret_cast<const unsigned char*>(source.data()), source.size(),
         kCFAllocatorNull));
@@ -96,6 +132,20 @@ PremultipliedImage decodeImage(const std::string& source) {
         throw std::runtime_error("CGImageSourceCreateWithData failed");
     }
 
+    if (const size_t maxPixelSize = thumbnailSize(*imageSource, options.targetSize)) {
+        NSDictionary *thumbnailOptions = @{
+            (__bridge NSString *)kCGImageSourceCreateThumbnailFromImageAlways: @YES,
+            (__bridge NSString *)kCGImageSourceCreateThumbnailWithTransform: @NO,
+            (__bridge NSString *)kCGImageSourceThumbnailMaxPixelSize: @(maxPixelSize),
+        };
+        CGImageHandle image(CGImageSourceCreateThumbnailAtIndex(
+            *imageSource, 0, (__bridge CFDictionaryRef)thumbnailOptions));
+        if (!image) {
+            throw std::runtime_error("CGImageSourceCreateThumbnailAtIndex failed");
+        }
+        return MGLPremultipliedImageFromCGImage(*image);
+    }
+
     CGImageHandle image(CGImageSourceCreateImageAtIndex(*imageSource, 0, NULL));
     if (!image) {
         throw std::runtime_error("CGImageSourceCreateImageAtIndex failed");
@@ -4,6 +4,7 @@
 #include <unicode/ubidi.h>
 #include <unicode/ushape.h>
 
+#include <algorithm>
 #include <memory>
 
 namespace mbgl {
@@ -52,7 +53,8 @@ std::u16string applyArabicShaping(const std::u16string& input) {
     return outputText;
 }
 
-void BiDi::mergeParagraphLineBreaks(std::set<size_t>& lineBreakPoints) {
+void BiDi::mergeParagraphLineBreaks(std::vector<size_t>& lineBreakPoints) {
+    const std::size_t lineBreakCount = lineBreakPoints.size();
     int32_t paragraphCount = ubidi_countParagraphs(impl->bidiText);
     for (int32_t i = 0; i < paragraphCount; i++) {
         UErrorCode errorCode = U_ZERO_ERROR;
@@ -64,31 +66,33 @@ void BiDi::mergeParagraphLineBreaks(std::set<size_t>& lineBreakPoints) {
                                      u_errorName(errorCode));
         }
 
-        lineBreakPoints.insert(static_cast<std::size_t>(paragraphEndIndex));
+        lineBreakPoints.push_back(static_cast<std::size_t>(paragraphEndIndex));
     }
+
+    // Both the line breaks and the paragraph ends are sorted; merge them and drop duplicates.
+    std::inplace_merge(lineBreakPoints.begin(), lineBreakPoints.begin() + lineBreakCount, lineBreakPoints.end());
+    lineBreakPoints.erase(std::unique(lineBreakPoints.begin(), lineBreakPoints.end()), lineBreakPoints.end());
 }
 
-std::vector<std::u16string> BiDi::applyLineBreaking(std::set<std::size_t> lineBreakPoints) {
+void BiDi::applyLineBreaking(std::vector<std::size_t>& lineBreakPoints, std::vector<std::u16string>& lines) {
     // BiDi::getLine will error if called across a paragraph boundary, so we need to ensure that all
     // paragraph boundaries are included in the set of line break points. The calling code might not
     // include the line break because it didn't need to wrap at that point, or because the text was
     // separated with a more exotic code point such as (U+001C)
     mergeParagraphLineBreaks(lineBreakPoints);
 
-    std::vector<std::u16string> transformedLines;
-    transformedLines.reserve(lineBreakPoints.size());
+    lines.resize(lineBreakPoints.size());
 
     std::size_t start = 0;
-    for (std::size_t lineBreakPoint : lineBreakPoints) {
-        transformedLines.push_back(getLine(start, lineBreakPoint));
-        start = lineBreakPoint;
+    for (std::size_t i = 0; i < lineBreakPoints.size(); i++) {
+        getLine(start, lineBreakPoints[i], lines[i]);
+        start = lineBreakPoints[i];
     }
-
-    return transformedLines;
 }
 
-std::vector<std::u16string> BiDi::processText(const std::u16string& input,
-                                              std::set<std::size_t> lineBreakPoints) {
+void BiDi::processText(const std::u16string& input,
+                       std::vector<std::size_t>& lineBreakPoints,
+                       std::vector<std::u16string>& lines) {
     UErrorCode errorCode = U_ZERO_ERROR;
 
     ubidi_setPara(impl->bidiText, mbgl::utf16char_cast<const UChar*>(input.c_str()), static_cast<int32_t>(input.size()),
@@ -98,10 +102,10 @@ std::vector<std::u16string> BiDi::processText(const std::u16string& input,
         throw std::runtime_error(std::string("BiDi::processText: ") + u_errorName(errorCode));
     }
 
-    return applyLineBreaking(lineBreakPoints);
+    applyLineBreaking(lineBreakPoints, lines);
 }
 
-std::u16string BiDi::getLine(std::size_t start, std::size_t end) {
+void BiDi::getLine(std::size_t start, std::size_t end, std::u16string& outputText) {
     UErrorCode errorCode = U_ZERO_ERROR;
     ubidi_setLine(impl->bidiText, static_cast<int32_t>(start), static_cast<int32_t>(end), impl->bidiLine, &errorCode);
 
@@ -113,7 +117,7 @@ std::u16string BiDi::getLine(std::size_t start, std::size_t end) {
     //  Setting UBIDI_INSERT_LRM_FOR_NUMERIC would require
     //  ubidi_getLength(pBiDi)+2*ubidi_countRuns(pBiDi)
     const int32_t outputLength = ubidi_getProcessedLength(impl->bidiLine);
-    std::u16string outputText(outputLength, 0);
+    outputText.resize(outputLength);
 
     // UBIDI_DO_MIRRORING: Apply unicode mirroring of characters like parentheses
     // UBIDI_REMOVE_BIDI_CONTROLS: Now that all the lines are set, remove control characters so that
@@ -125,8 +129,6 @@ std::u16string BiDi::getLine(std::size_t start, std::size_t end) {
         throw std::runtime_error(std::string("BiDi::getLine (writeReordered): ") +
                                  u_errorName(errorCode));
     }
-
-    return outputText;
 }
 
 } // end namespace mbgl
@@ -5,9 +5,12 @@
 #include <mbgl/storage/online_file_source.hpp>
 #include <mbgl/storage/offline_database.hpp>
 #include <mbgl/storage/offline_download.hpp>
+#include <mbgl/storage/response_cache.hpp>
 #include <mbgl/storage/resource_transform.hpp>
 
+#include <mbgl/util/logging.hpp>
 #include <mbgl/util/platform.hpp>
+#include <mbgl/util/string.hpp>
 #include <mbgl/util/url.hpp>
 #include <mbgl/util/thread.hpp>
 #include <mbgl/util/work_request.hpp>
@@ -22,15 +25,70 @@ bool isAssetURL(const std::string& url) {
     return std::equal(assetProtocol.begin(), assetProtocol.end(), url.begin());
 }
 
+// Number of threads with their own read-only database connection that serve cache lookups, so
+// that cache hits don't wait behind writes such as region downloads and eviction.
+const std::size_t databaseReaderCount = 2;
+
+// Size of the in-memory cache of recently used responses in front of the offline database.
+const uint64_t memoryCacheSize = 16 * 1024 * 1024;
+
 } // namespace
 
 namespace mbgl {
 
+namespace {
+
+// Whether the offline database should be consulted before going to the network.
+bool acceptsCachedResponse(const Resource& resource) {
+    const bool hasPrior = resource.priorEtag || resource.priorModified || resource.priorExpires;
+    return !hasPrior || resource.necessity == Resource::Optional;
+}
+
+// Responds with the response found in the offline database if it is usable, and returns the
+// resource to request from the network, carrying the validators of the cached response.
+Resource respondFromCache(const Resource& resource,
+                          optional<Response> offlineResponse,
+                          const std::function<void (const Response&)>& callback) {
+    Resource revalidation = resource;
+
+    if (resource.necessity == Resource::Optional && !offlineResponse) {
+        // Ensure there's always a response that we can send, so the caller knows that
+        // there's no optional data available in the cache.
+        offlineResponse.emplace();
+        offlineResponse->noContent = true;
+        offlineResponse->error = std::make_unique<Response::Error>(
+                Response::Error::Reason::NotFound, "Not found in offline database");
+    }
+
+    if (offlineResponse) {
+        revalidation.priorModified = offlineResponse->modified;
+        revalidation.priorExpires = offlineResponse->expires;
+        revalidation.priorEtag = offlineResponse->etag;
+
+        // Don't return resources the server requested not to show when they're stale.
+        // Even if we can't directly use the response, we may still use it to send a
+        // conditional HTTP request.
+        if (offlineResponse->isUsable()) {
+            callback(*offlineResponse);
+        } else {
+            // Since we can't return the data immediately, we'll have to hold on so that
+            // we can return it later in case we get a 304 Not Modified response.
+            revalidation.priorData = offlineResponse->data;
+        }
+    }
+
+    return revalidation;
+}
+
+} // namespace
+
 class DefaultFileSource::Impl {
 public:
-    Impl(ActorRef<Impl>, std::shared_ptr<FileSource> assetFileSource_, const std::string& cachePath, uint64_t maximumCacheSize)
-            : assetFileSource(assetFileSource_)
+    Impl(ActorRef<Impl> self_, std::shared_ptr<FileSource> assetFileSource_, std::shared_ptr<ResponseCache> memoryCache_, const std::string& cachePath, uint64_t maximumCacheSize)
+            : self(std::move(self_))
+            , assetFileSource(assetFileSource_)
             , localFileSource(std::make_unique<LocalFileSource>())
+            , memoryCache(std::move(memoryCache_))
             , offlineDatabase(cachePath, maximumCacheSize) {
     }
 
@@ -54,6 +112,10 @@ public:
         onlineFileSource.setResourceTransform(std::move(transform));
     }
 
+    void setMaximumConnectionsPerHost(uint32_t maximum) {
+        onlineFileSource.setMaximumConnectionsPerHost(maximum);
+    }
+
     void listRegions(std::function<void (std::exception_ptr, optional<std::vector<OfflineRegion>>)> callback) {
         try {
             callback({}, offlineDatabase.listRegions());
@@ -108,64 +170,64 @@ public:
         getDownload(regionID).setState(state);
     }
 
-    void request(AsyncRequest* req, Resource resource, ActorRef<FileSourceRequest> ref) {
+    void request(uint64_t requestID, Resource resource, ActorRef<FileSourceRequest> ref) {
         auto callback = [ref] (const Response& res) mutable {
             ref.invoke(&FileSourceRequest::setResponse, res);
         };
 
         if (isAssetURL(resource.url)) {
             //Asset request
-            tasks[req] = assetFileSource->request(resource, callback);
+            tasks[requestID] = assetFileSource->request(resource, callback);
         } else if (LocalFileSource::acceptsURL(resource.url)) {
             //Local file request
-            tasks[req] = localFileSource->request(resource, callback);
+            tasks[requestID] = localFileSource->request(resource, callback);
         } else {
             // Try the offline database
-            Resource revalidation = resource;
-
-            const bool hasPrior = resource.priorEtag || resource.priorModified || resource.priorExpires;
-            if (!hasPrior || resource.necessity == Resource::Optional) {
-                auto offlineResponse = offlineDatabase.get(resource);
-
-                if (resource.necessity == Resource::Optional && !offlineResponse) {
-                    // Ensure there's always a response that we can send, so the caller knows that
-                    // there's no optional data available in the cache.
-                    offlineResponse.emplace();
-                    offlineResponse->noContent = true;
-                    offlineResponse->error = std::make_unique<Response::Error>(
-                            Response::Error::Reason::NotFound, "Not found in offline database");
-                }
-
+            optional<Response> offlineResponse;
+            if (acceptsCachedResponse(resource)) {
+                offlineResponse = memoryCache->get(resource);
                 if (offlineResponse) {
-                    revalidation.priorModified = offlineResponse->modified;
-                    revalidation.priorExpires = offlineResponse->expires;
-                    revalidation.priorEtag = offlineResponse->etag;
-
-                    // Don't return resources the server requested not to show when they're stale.
-                    // Even if we can't directly use the response, we may still use it to send a
-                    // conditional HTTP request.
-                    if (offlineResponse->isUsable()) {
-                        callback(*offlineResponse);
-                    } else {
-                        // Since we can't return the data immediately, we'll have to hold on so that
-                        // we can return it later in case we get a 304 Not Modified response.
-                        revalidation.priorData = offlineResponse->data;
+                    offlineDatabase.markAccessed(resource);
+                } else {
+                    offlineResponse = offlineDatabase.get(resource);
+                    if (offlineResponse) {
+                        memoryCache->put(resource, *offlineResponse);
                     }
                 }
             }
 
+            Resource revalidation = respondFromCache(resource, std::move(offlineResponse), callback);
+
             // Get from the online file source
             if (resource.necessity == Resource::Required) {
-                tasks[req] = onlineFileSource.request(revalidation, [=] (Response onlineResponse) mutable {
-                    this->offlineDatabase.put(revalidation, onlineResponse);
-                    callback(onlineResponse);
-                });
+                requestFromNetwork(requestID, std::move(revalidation), std::move(ref));
             }
         }
     }
 
-    void cancel(AsyncRequest* req) {
-        tasks.erase(req);
+    // Continues a request after a reader has looked it up in the offline database.
+    void requestFromNetwork(uint64_t requestID, Resource revalidation, ActorRef<FileSourceRequest> ref) {
+        tasks[requestID] = onlineFileSource.request(revalidation, [=] (Response onlineResponse) mutable {
+            this->offlineDatabase.put(revalidation, onlineResponse);
+            this->memoryCache->put(revalidation, onlineResponse);
+            this->scheduleEviction();
+            ref.invoke(&FileSourceRequest::setResponse, onlineResponse);
+        });
+    }
+
+    void cancel(uint64_t requestID) {
+        tasks.erase(requestID);
+    }
+
+    void setPriority(uint64_t requestID, int32_t priority) {
+        auto it = tasks.find(requestID);
+        if (it != tasks.end()) {
+            it->second->setPriority(priority);
+        }
+    }
+
+    void markAccessed(const Resource& resource) {
+        offlineDatabase.markAccessed(resource);
     }
 
     void setOfflineMapboxTileCountLimit(uint64_t limit) {
@@ -174,9 +236,38 @@ public:
 
     void put(const Resource& resource, const Response& response) {
         offlineDatabase.put(resource, response);
+        memoryCache->put(resource, response);
+        scheduleEviction();
+    }
+
+    void evict() {
+        bool evictedAll = true;
+        try {
+            evictedAll = !offlineDatabase.evictBatch();
+        } catch (...) {
+            Log::Error(Event::Database, "Unexpected error evicting from database: %s",
+                       util::toString(std::current_exception()).c_str());
+        }
+
+        if (evictedAll) {
+            evictionScheduled = false;
+        } else {
+            // Messages that arrived during this batch are handled before the next one.
+            self.invoke(&Impl::evict);
+        }
     }
 
 private:
+    // Evicts from the ambient cache once the messages that are already queued have been handled,
+    // rather than in the middle of answering a request. Each batch is posted separately, so that
+    // requests don't wait for the whole eviction.
+    void scheduleEviction() {
+        if (!evictionScheduled && offlineDatabase.needsEviction()) {
+            evictionScheduled = true;
+            self.invoke(&Impl::evict);
+        }
+    }
+
     OfflineDownload& getDownload(int64_t regionID) {
         auto it = downloads.find(regionID);
         if (it != downloads.end()) {
@@ -186,15 +277,78 @@ private:
             std::make_unique<OfflineDownload>(regionID, offlineDatabase.getRegionDefinition(regionID), offlineDatabase, onlineFileSource)).first->second;
     }
 
+    ActorRef<Impl> self;
+    bool evictionScheduled = false;
+
     // shared so that destruction is done on the creating thread
     const std::shared_ptr<FileSource> assetFileSource;
     const std::unique_ptr<FileSource> localFileSource;
+    const std::shared_ptr<ResponseCache> memoryCache;
     OfflineDatabase offlineDatabase;
     OnlineFileSource onlineFileSource;
-    std::unordered_map<AsyncRequest*, std::unique_ptr<AsyncRequest>> tasks;
+    std::unordered_map<uint64_t, std::unique_ptr<AsyncRequest>> tasks;
     std::unordered_map<int64_t, std::unique_ptr<OfflineDownload>> downloads;
 };
 
+// Serves cache lookups from a read-only connection to the offline database. Requests that can't be
+// answered from the cache alone are passed on to Impl, which owns the only writable connection.
+class DefaultFileSource::ReadImpl {
+public:
+    ReadImpl(ActorRef<ReadImpl>, const std::string& cachePath, std::shared_ptr<ResponseCache> memoryCache_, ActorRef<Impl> impl_)
+        : memoryCache(std::move(memoryCache_)),
+          offlineDatabase(cachePath, 0, OfflineDatabase::Access::ReadOnly),
+          impl(std::move(impl_)) {
+    }
+
+    void request(uint64_t requestID, Resource resource, ActorRef<FileSourceRequest> ref) {
+        optional<Response> offlineResponse;
+        if (acceptsCachedResponse(resource)) {
+            try {
+                offlineResponse = memoryCache->get(resource);
+                if (!offlineResponse) {
+                    offlineResponse = offlineDatabase.get(resource);
+                    if (offlineResponse) {
+                        memoryCache->put(resource, *offlineResponse);
+                    }
+                }
+            } catch (...) {
+                Log::Error(Event::Database, "Unexpected error reading from database: %s",
+                           util::toString(std::current_exception()).c_str());
+                impl.invoke(&Impl::request, requestID, std::move(resource), std::move(ref));
+                return;
+            }
+
+            if (offlineResponse) {
+                impl.invoke(&Impl::markAccessed, resource);
+            }
+        }
+
+        Resource revalidation = respondFromCache(resource, std::move(offlineResponse),
+            [ref] (const Response& res) mutable {
+                ref.invoke(&FileSourceRequest::setResponse, res);
+            });
+
+        if (resource.necessity == Resource::Required) {
+            impl.invoke(&Impl::requestFromNetwork, requestID, std::move(revalidation), std::move(ref));
+        }
+    }
+
+    // Cancellations take the same route as the request they cancel, so that they can't overtake
+    // a request that is being passed on to Impl.
+    void cancel(uint64_t requestID) {
+        impl.invoke(&Impl::cancel, requestID);
+    }
+
+    void setPriority(uint64_t requestID, int32_t priority) {
+        impl.invoke(&Impl::setPriority, requestID, priority);
+    }
+
+private:
+    const std::shared_ptr<ResponseCache> memoryCache;
+    OfflineDatabase offlineDatabase;
+    ActorRef<Impl> impl;
+};
+
 DefaultFileSource::DefaultFileSource(const std::string& cachePath,
                                      const std::string& assetRoot,
                                      uint64_t maximumCacheSize)
@@ -205,7 +359,16 @@ DefaultFileSource::DefaultFileSource(const std::string& cachePath,
                                      std::unique_ptr<FileSource>&& assetFileSource_,
                                      uint64_t maximumCacheSize)
         : assetFileSource(std::move(assetFileSource_))
-        , impl(std::make_unique<util::Thread<Impl>>("DefaultFileSource", assetFileSource, cachePath, maximumCacheSize)) {
+        , memoryCache(std::make_shared<ResponseCache>(memoryCacheSize))
+        , impl(std::make_unique<util::Thread<Impl>>("DefaultFileSource", assetFileSource, memoryCache, cachePath, maximumCacheSize)) {
+    // In-memory databases can't be shared between connections. Readers are created once Impl has
+    // finished creating or migrating the database.
+    if (cachePath != ":memory:") {
+        for (std::size_t i = 0; i < databaseReaderCount; i++) {
+            readers.push_back(std::make_unique<util::Thread<ReadImpl>>(
+                "DefaultFileSource reader", cachePath, memoryCache, impl->actor()));
+        }
+    }
 }
 
 DefaultFileSource::~DefaultFileSource() = default;
@@ -242,16 +405,43 @@ void DefaultFileSource::setResourceTransform(optional<ActorRef<ResourceTransform
     impl->actor().invoke(&Impl::setResourceTransform, std::move(transform));
 }
 
+void DefaultFileSource::setMaximumConnectionsPerHost(uint32_t maximum) {
+    impl->actor().invoke(&Impl::setMaximumConnectionsPerHost, maximum);
+}
+
 std::unique_ptr<AsyncRequest> DefaultFileSource::request(const Resource& resource, Callback callback) {
     auto req = std::make_unique<FileSourceRequest>(std::move(callback));
+    const uint64_t requestID = nextRequestID++;
 
-    req->onCancel([fs = impl->actor(), req = req.get()] () mutable { fs.invoke(&Impl::cancel, req); });
+    if (readers.empty() || isAssetURL(resource.url) || LocalFileSource::acceptsURL(resource.url)) {
+        req->onCancel([fs = impl->actor(), requestID] () mutable { fs.invoke(&Impl::cancel, requestID); });
+        req->onPriorityChange([fs = impl->actor(), requestID] (int32_t priority) mutable {
+            fs.invoke(&Impl::setPriority, requestID, priority);
+        });
 
-    impl->actor().invoke(&Impl::request, req.get(), resource, req->actor());
+        impl->actor().invoke(&Impl::request, requestID, resource, req->actor());
+    } else {
+        auto reader = readers[nextReader++ % readers.size()]->actor();
+
+        req->onCancel([reader, requestID] () mutable { reader.invoke(&ReadImpl::cancel, requestID); });
+        req->onPriorityChange([reader, requestID] (int32_t priority) mutable {
+            reader.invoke(&ReadImpl::setPriority, requestID, priority);
+        });
+
+        reader.invoke(&ReadImpl::request, requestID, resource, req->actor());
+    }
 
     return std::move(req);
 }
 
+uint64_t DefaultFileSource::getMemoryCacheHits() const {
+    return memoryCache->hits();
+}
+
+uint64_t DefaultFileSource::getMemoryCacheMisses() const {
+    return memoryCache->misses();
+}
+
 void DefaultFileSource::listOfflineRegions(std::function<void (std::exception_ptr, optional<std::vector<OfflineRegion>>)> callback) {
     impl->actor().invoke(&Impl::listRegions, callback);
 }
@@ -290,9 +480,15 @@ void DefaultFileSource::setOfflineMapboxTileCountLimit(uint64_t limit) const {
 
 void DefaultFileSource::pause() {
     impl->pause();
+    for (auto& reader : readers) {
+        reader->pause();
+    }
 }
 
 void DefaultFileSource::resume() {
+    for (auto& reader : readers) {
+        reader->resume();
+    }
     impl->resume();
 }
 
@@ -8,6 +8,7 @@
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/timer.hpp>
+#include <mbgl/util/url.hpp>
 #include <mbgl/util/chrono.hpp>
 #include <mbgl/util/http_header.hpp>
 
@@ -15,6 +16,8 @@
 
 #include <queue>
 #include <map>
+#include <string>
+#include <unordered_set>
 #include <cassert>
 #include <cstring>
 #include <cstdio>
@@ -33,6 +36,18 @@ static void handleError(CURLcode code) {
 
 namespace mbgl {
 
+namespace {
+
+// Number of requests that may be in flight at once while responses arrive multiplexed over
+// HTTP/2 connections. Streams share a single connection, so this is bounded by the server's
+// stream limit rather than by the cost of opening connections.
+const uint32_t maximumMultiplexedRequests = 100;
+
+// Number of idle easy handles kept around for reuse.
+const size_t maximumPooledHandles = maximumMultiplexedRequests;
+
+} // namespace
+
 class HTTPFileSource::Impl {
 public:
     Impl();
@@ -60,6 +75,9 @@ public:
     // A queue that we use for storing resuable CURL easy handles to avoid creating and destroying
     // them all the time.
     std::queue<CURL *> handles;
+
+    // Origins whose most recently completed response was multiplexed over a shared connection.
+    std::unordered_set<std::string> multiplexedOrigins;
 };
 
 class HTTPRequest : public AsyncRequest {
@@ -102,6 +120,11 @@ HTTPFileSource::Impl::Impl() {
     handleError(curl_multi_setopt(multi, CURLMOPT_SOCKETDATA, this));
     handleError(curl_multi_setopt(multi, CURLMOPT_TIMERFUNCTION, startTimeout));
     handleError(curl_multi_setopt(multi, CURLMOPT_TIMERDATA, this));
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (43) << 8 | 0) // Added in 7.43.0
+    // Send requests to the same host as concurrent streams over one HTTP/2 connection when the
+    // server supports it, instead of opening a connection per request.
+    handleError(curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX));
+#endif
 }
 
 HTTPFileSource::Impl::~Impl() {
@@ -130,6 +153,12 @@ CURL *HTTPFileSource::Impl::getHandle() {
 }
 
 void HTTPFileSource::Impl::returnHandle(CURL *handle) {
+    if (handles.size() >= maximumPooledHandles) {
+        curl_easy_cleanup(handle);
+        return;
+    }
+
+    // Resetting keeps the handle's connection, DNS and TLS session caches alive.
     curl_easy_reset(handle);
     handles.push(handle);
 }
@@ -260,6 +289,16 @@ HTTPRequest::HTTPRequest(HTTPFileSource::Impl* context_, Resource resource_, Fil
 #endif
     handleError(curl_easy_setopt(handle, CURLOPT_USERAGENT, "MapboxGL/1.0"));
     handleError(curl_easy_setopt(handle, CURLOPT_SHARE, context->share));
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (47) << 8 | 0) // Added in 7.47.0
+    // Negotiate HTTP/2 via ALPN for HTTPS URLs; plain HTTP keeps using HTTP/1.1. Not checked for
+    // errors, since cURL builds without HTTP/2 support reject this option.
+    curl_easy_setopt(handle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+#endif
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (43) << 8 | 0) // Added in 7.43.0
+    // Prefer waiting for a connection that is being established to the same host so that the
+    // request can be multiplexed over it, rather than opening another connection.
+    handleError(curl_easy_setopt(handle, CURLOPT_PIPEWAIT, 1L));
+#endif
 
     // Start requesting the information.
     handleError(curl_multi_add_handle(context->multi, handle));
@@ -366,6 +405,17 @@ void HTTPRequest::handleResult(CURLcode code) {
             break;
         }
     } else {
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (50) << 8 | 0) // Added in 7.50.0
+        long httpVersion = 0;
+        if (curl_easy_getinfo(handle, CURLINFO_HTTP_VERSION, &httpVersion) == CURLE_OK) {
+            if (httpVersion == CURL_HTTP_VERSION_2_0) {
+                context->multiplexedOrigins.insert(util::origin(resource.url));
+            } else {
+                context->multiplexedOrigins.erase(util::origin(resource.url));
+            }
+        }
+#endif
+
         long responseCode = 0;
         curl_easy_getinfo(handle, CURLINFO_RESPONSE_CODE, &responseCode);
 
@@ -417,4 +467,17 @@ uint32_t HTTPFileSource::maximumConcurrentRequests() {
     return 20;
 }
 
+uint32_t HTTPFileSource::multiplexedRequestLimit(const std::string& url) const {
+    return impl->multiplexedOrigins.count(util::origin(url)) ? maximumMultiplexedRequests : 0;
+}
+
+void HTTPFileSource::setMaximumConnectionsPerHost(uint32_t maximum) {
+#if LIBCURL_VERSION_NUM >= ((7) << 16 | (30) << 8 | 0) // Added in 7.30.0
+    // Requests beyond the limit are queued by cURL until a connection becomes available.
+    handleError(curl_multi_setopt(impl->multi, CURLMOPT_MAX_HOST_CONNECTIONS, long(maximum)));
+#else
+    (void)maximum;
+#endif
+}
+
 } // namespace mbgl
@@ -1,4 +1,5 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_decoder.hpp>
 #include <mbgl/util/char_array_buffer.hpp>
 
 #include <istream>
@@ -89,7 +90,23 @@ struct jpeg_info_guard {
     jpeg_decompress_struct* i_;
 };
 
-PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
+// Picks the largest libjpeg DCT scaling denominator (1, 2, 4 or 8) for which the decoded
+// image still covers the target size.
+static unsigned int scaleDenominator(const jpeg_decompress_struct& cinfo, const optional<Size>& targetSize) {
+    if (!targetSize || targetSize->isEmpty()) {
+        return 1;
+    }
+
+    unsigned int denominator = 8;
+    while (denominator > 1 &&
+           ((cinfo.image_width + denominator - 1) / denominator < targetSize->width ||
+            (cinfo.image_height + denominator - 1) / denominator < targetSize->height)) {
+        denominator /= 2;
+    }
+    return denominator;
+}
+
+PremultipliedImage decodeJPEG(const uint8_t* data, size_t size, const ImageDecodeOptions& options) {
     util::CharArrayBuffer dataBuffer { reinterpret_cast<const char*>(data), size };
     std::istream stream(&dataBuffer);
 
@@ -106,6 +123,22 @@ PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
     if (ret != JPEG_HEADER_OK)
         throw std::runtime_error("JPEG Reader: failed to read header");
 
+    // Let the IDCT produce a downscaled image when the full resolution isn't needed.
+    cinfo.scale_num = 1;
+    cinfo.scale_denom = scaleDenominator(cinfo, options.targetSize);
+
+#if defined(JCS_EXTENSIONS)
+    // libjpeg-turbo can write RGBA scanlines with an opaque alpha channel directly.
+    const bool directRGBA = cinfo.jpeg_color_space == JCS_YCbCr ||
+                            cinfo.jpeg_color_space == JCS_RGB ||
+                            cinfo.jpeg_color_space == JCS_GRAYSCALE;
+    if (directRGBA) {
+        cinfo.out_color_space = JCS_EXT_RGBA;
+    }
+#else
+    const bool directRGBA = false;
+#endif
+
     jpeg_start_decompress(&cinfo);
 
     if (cinfo.out_color_space == JCS_UNKNOWN)
@@ -116,12 +149,24 @@ PremultipliedImage decodeJPEG(const uint8_t* data, size_t size) {
 
     size_t width = cinfo.output_width;
     size_t height = cinfo.output_height;
-    size_t components = cinfo.output_components;
-    size_t rowStride = components * width;
 
-    PremultipliedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+    PremultipliedImage image = options.allocate({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
     uint8_t* dst = image.data.get();
 
+    if (directRGBA) {
+        while (cinfo.output_scanline < cinfo.output_height) {
+            JSAMPROW row = dst + cinfo.output_scanline * image.stride();
+            jpeg_read_scanlines(&cinfo, &row, 1);
+        }
+
+        jpeg_finish_decompress(&cinfo);
+
+        return image;
+    }
+
+    size_t components = cinfo.output_components;
+    size_t rowStride = components * width;
+
     JSAMPARRAY buffer = (*cinfo.mem->alloc_sarray)((j_common_ptr) &cinfo, JPOOL_IMAGE, rowStride, 1);
 
     while (cinfo.output_scanline < cinfo.output_height) {
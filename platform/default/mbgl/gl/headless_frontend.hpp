@@ -3,8 +3,10 @@
 #include <mbgl/renderer/renderer_frontend.hpp>
 #include <mbgl/gl/headless_backend.hpp>
 #include <mbgl/util/async_task.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <memory>
+#include <string>
 
 namespace mbgl {
 
@@ -16,8 +18,10 @@ class Map;
 
 class HeadlessFrontend : public RendererFrontend {
 public:
-    HeadlessFrontend(float pixelRatio_, FileSource&, Scheduler&);
-    HeadlessFrontend(Size, float pixelRatio_, FileSource&, Scheduler&);
+    HeadlessFrontend(float pixelRatio_, FileSource&, Scheduler&,
+                     const optional<std::string> layoutCacheDir = {});
+    HeadlessFrontend(Size, float pixelRatio_, FileSource&, Scheduler&,
+                     const optional<std::string> layoutCacheDir = {});
     ~HeadlessFrontend() override;
 
     void reset() override;
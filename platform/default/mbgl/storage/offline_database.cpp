@@ -8,23 +8,49 @@
 
 #include "sqlite3.hpp"
 
+#include <algorithm>
+
 namespace mbgl {
 
+namespace {
+
+// Access times are only written when they moved on by at least this much, so that repeated hits
+// on the same resources don't turn reads into writes. Eviction order is approximate within it.
+constexpr Seconds accessTimeGranularity = std::chrono::minutes(10);
+
+constexpr Seconds accessTimesFlushInterval = std::chrono::minutes(1);
+constexpr std::size_t maximumPendingAccessTimes = 1024;
+
+// Number of least recently used entries that eviction looks at per query.
+constexpr int64_t evictionBatchSize = 1000;
+
+} // namespace
+
 OfflineDatabase::Statement::~Statement() {
     stmt.reset();
     stmt.clearBindings();
 }
 
-OfflineDatabase::OfflineDatabase(std::string path_, uint64_t maximumCacheSize_)
+OfflineDatabase::OfflineDatabase(std::string path_, uint64_t maximumCacheSize_, Access access_)
     : path(std::move(path_)),
-      maximumCacheSize(maximumCacheSize_) {
-    ensureSchema();
+      access(access_),
+      maximumCacheSize(maximumCacheSize_),
+      lastAccessTimesFlush(util::now()) {
+    if (access == Access::ReadOnly) {
+        assert(path != ":memory:");
+        connect(mapbox::sqlite::ReadOnly);
+    } else {
+        ensureSchema();
+    }
 }
 
 OfflineDatabase::~OfflineDatabase() {
     // Deleting these SQLite objects may result in exceptions, but we're in a destructor, so we
     // can't throw anything.
     try {
+        if (db) {
+            flushAccessTimes();
+        }
         statements.clear();
         db.reset();
     } catch (mapbox::sqlite::Exception& ex) {
@@ -50,7 +76,9 @@ void OfflineDatabase::ensureSchema() {
             case 3: // no-op and fall through
             case 4: migrateToVersion5(); // fall through
             case 5: migrateToVersion6(); // fall through
-            case 6: return;
+            case 6: migrateToVersion7(); // fall through
+            case 7: migrateToVersion8(); // fall through
+            case 8: return;
             default: throw std::runtime_error("unknown schema version");
             }
 
@@ -81,10 +109,10 @@ void OfflineDatabase::ensureSchema() {
 
         // If you change the schema you must write a migration from the previous version.
         db->exec("PRAGMA auto_vacuum = INCREMENTAL");
-        db->exec("PRAGMA journal_mode = DELETE");
+        db->exec("PRAGMA journal_mode = WAL");
         db->exec("PRAGMA synchronous = FULL");
         db->exec(schema);
-        db->exec("PRAGMA user_version = 6");
+        db->exec("PRAGMA user_version = 8");
     } catch (...) {
         Log::Error(Event::Database, "Unexpected error creating database schema: %s", util::toString(std::current_exception()).c_str());
         throw;
@@ -135,6 +163,31 @@ void OfflineDatabase::migrateToVersion6() {
     transaction.commit();
 }
 
+// Version 7 switches to a write-ahead log so that reads on other connections don't wait for
+// writes. Synchronous mode stays FULL, which syncs the log on every commit, so committed data
+// survives crashes and power loss just like it did with the rollback journal.
+void OfflineDatabase::migrateToVersion7() {
+    db->exec("PRAGMA journal_mode = WAL");
+    db->exec("PRAGMA synchronous = FULL");
+    db->exec("PRAGMA user_version = 7");
+}
+
+// Version 8 marks resources and tiles used by regions, so that eviction can find ambient ones
+// through an index instead of joining against region_resources and region_tiles.
+void OfflineDatabase::migrateToVersion8() {
+    mapbox::sqlite::Transaction transaction(*db);
+    db->exec("ALTER TABLE resources ADD COLUMN region_owned INTEGER NOT NULL DEFAULT 0");
+    db->exec("ALTER TABLE tiles ADD COLUMN region_owned INTEGER NOT NULL DEFAULT 0");
+    db->exec("UPDATE resources SET region_owned = 1 WHERE id IN (SELECT resource_id FROM region_resources)");
+    db->exec("UPDATE tiles SET region_owned = 1 WHERE id IN (SELECT tile_id FROM region_tiles)");
+    db->exec("DROP INDEX resources_accessed");
+    db->exec("DROP INDEX tiles_accessed");
+    db->exec("CREATE INDEX resources_region_owned_accessed ON resources (region_owned, accessed)");
+    db->exec("CREATE INDEX tiles_region_owned_accessed ON tiles (region_owned, accessed)");
+    db->exec("PRAGMA user_version = 8");
+    transaction.commit();
+}
+
 OfflineDatabase::Statement OfflineDatabase::getStatement(const char * sql) {
     auto it = statements.find(sql);
 
@@ -151,12 +204,92 @@ optional<Response> OfflineDatabase::get(const Resource& resource) {
 }
 
 optional<std::pair<Response, uint64_t>> OfflineDatabase::getInternal(const Resource& resource) {
+    optional<std::pair<Response, uint64_t>> result;
+
     if (resource.kind == Resource::Kind::Tile) {
         assert(resource.tileData);
-        return getTile(*resource.tileData);
+        result = getTile(*resource.tileData);
     } else {
-        return getResource(resource);
+        result = getResource(resource);
+    }
+
+    if (result && access == Access::ReadWrite) {
+        markAccessed(resource);
+    }
+
+    return result;
+}
+
+void OfflineDatabase::markAccessed(const Resource& resource) {
+    const Timestamp now = util::now();
+
+    if (resource.kind == Resource::Kind::Tile) {
+        assert(resource.tileData);
+        const Resource::TileData& tile = *resource.tileData;
+        accessedTiles[std::make_tuple(tile.urlTemplate, tile.pixelRatio, tile.x, tile.y, tile.z)] = now;
+    } else {
+        accessedResources[resource.url] = now;
+    }
+
+    if (now - lastAccessTimesFlush >= accessTimesFlushInterval ||
+        accessedTiles.size() + accessedResources.size() >= maximumPendingAccessTimes) {
+        flushAccessTimes();
+    }
+}
+
+void OfflineDatabase::flushAccessTimes() {
+    lastAccessTimesFlush = util::now();
+
+    if (accessedTiles.empty() && accessedResources.empty()) {
+        return;
+    }
+
+    mapbox::sqlite::Transaction transaction(*db, mapbox::sqlite::Transaction::Immediate);
+
+    // clang-format off
+    Statement resourceStmt = getStatement(
+        "UPDATE resources "
+        "SET accessed = ?1 "
+        "WHERE url    = ?2 "
+        "  AND accessed < ?3 ");
+    // clang-format on
+
+    for (const auto& resource : accessedResources) {
+        resourceStmt->bind(1, resource.second);
+        resourceStmt->bind(2, resource.first);
+        resourceStmt->bind(3, resource.second - accessTimeGranularity);
+        resourceStmt->run();
+        resourceStmt->reset();
     }
+
+    // clang-format off
+    Statement tileStmt = getStatement(
+        "UPDATE tiles "
+        "SET accessed       = ?1 "
+        "WHERE url_template = ?2 "
+        "  AND pixel_ratio  = ?3 "
+        "  AND x            = ?4 "
+        "  AND y            = ?5 "
+        "  AND z            = ?6 "
+        "  AND accessed     < ?7 ");
+    // clang-format on
+
+    for (const auto& tile : accessedTiles) {
+        tileStmt->bind(1, tile.second);
+        tileStmt->bind(2, std::get<0>(tile.first));
+        tileStmt->bind(3, std::get<1>(tile.first));
+        tileStmt->bind(4, std::get<2>(tile.first));
+        tileStmt->bind(5, std::get<3>(tile.first));
+        tileStmt->bind(6, std::get<4>(tile.first));
+        tileStmt->bind(7, tile.second - accessTimeGranularity);
+        tileStmt->run();
+        tileStmt->reset();
+    }
+
+    transaction.commit();
+
+    accessedTiles.clear();
+    accessedResources.clear();
 }
 
 optional<int64_t> OfflineDatabase::hasInternal(const Resource& resource) {
@@ -172,7 +305,7 @@ std::pair<bool, uint64_t> OfflineDatabase::put(const Resource& resource, const R
     return putInternal(resource, response, true);
 }
 
-std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource, const Response& response, bool evict_) {
+std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource, const Response& response, bool ambient) {
     if (response.error) {
         return { false, 0 };
     }
@@ -187,11 +320,20 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
         size = compressed ? compressedData.size() : response.data->size();
     }
 
-    if (evict_ && !evict(size)) {
+    // The addition of pageSize is a fudge factor to account for non `data` column
+    // size, and because pages can get fragmented on the database.
+    if (ambient && size + getPragma<int64_t>("PRAGMA page_size") > maximumCacheSize) {
         Log::Debug(Event::Database, "Unable to make space for entry");
         return { false, 0 };
     }
 
+    // Keep the ambient cache size up to date, unless it hasn't been calculated yet.
+    const bool updateAmbientCacheSize = ambientCacheSize && !response.notModified;
+    optional<std::pair<uint64_t, bool>> previous;
+    if (updateAmbientCacheSize) {
+        previous = getStoredSize(resource);
+    }
+
     bool inserted;
 
     if (resource.kind == Resource::Kind::Tile) {
@@ -205,19 +347,56 @@ std::pair<bool, uint64_t> OfflineDatabase::putInternal(const Resource& resource,
                 compressed);
     }
 
+    if (updateAmbientCacheSize && !(previous && previous->second)) {
+        *ambientCacheSize += size;
+        *ambientCacheSize -= std::min(*ambientCacheSize, previous ? previous->first : 0);
+    }
+
     return { inserted, size };
 }
 
-optional<std::pair<Response, uint64_t>> OfflineDatabase::getResource(const Resource& resource) {
-    // clang-format off
-    Statement accessedStmt = getStatement(
-        "UPDATE resources SET accessed = ?1 WHERE url = ?2");
-    // clang-format on
+optional<std::pair<uint64_t, bool>> OfflineDatabase::getStoredSize(const Resource& resource) {
+    if (resource.kind == Resource::Kind::Tile) {
+        assert(resource.tileData);
+        const Resource::TileData& tile = *resource.tileData;
 
-    accessedStmt->bind(1, util::now());
-    accessedStmt->bind(2, resource.url);
-    accessedStmt->run();
+        // clang-format off
+        Statement stmt = getStatement(
+            "SELECT length(data), region_owned "
+            "FROM tiles "
+            "WHERE url_template = ?1 "
+            "  AND pixel_ratio  = ?2 "
+            "  AND x            = ?3 "
+            "  AND y            = ?4 "
+            "  AND z            = ?5 ");
+        // clang-format on
+
+        stmt->bind(1, tile.urlTemplate);
+        stmt->bind(2, tile.pixelRatio);
+        stmt->bind(3, tile.x);
+        stmt->bind(4, tile.y);
+        stmt->bind(5, tile.z);
+        if (!stmt->run()) {
+            return {};
+        }
 
+        return std::make_pair(uint64_t(stmt->get<optional<int64_t>>(0).value_or(0)), stmt->get<bool>(1));
+    } else {
+        // clang-format off
+        Statement stmt = getStatement(
+            "SELECT length(data), region_owned FROM resources WHERE url = ?1");
+        // clang-format on
+
+        stmt->bind(1, resource.url);
+        if (!stmt->run()) {
+            return {};
+        }
+
+        return std::make_pair(uint64_t(stmt->get<optional<int64_t>>(0).value_or(0)), stmt->get<bool>(1));
+    }
+}
+
+optional<std::pair<Response, uint64_t>> OfflineDatabase::getResource(const Resource& resource) {
     // clang-format off
     Statement stmt = getStatement(
         //        0      1            2            3       4      5
@@ -360,25 +539,6 @@ bool OfflineDatabase::putResource(const Resource& resource,
 }
 
 optional<std::pair<Response, uint64_t>> OfflineDatabase::getTile(const Resource::TileData& tile) {
-    // clang-format off
-    Statement accessedStmt = getStatement(
-        "UPDATE tiles "
-        "SET accessed       = ?1 "
-        "WHERE url_template = ?2 "
-        "  AND pixel_ratio  = ?3 "
-        "  AND x            = ?4 "
-        "  AND y            = ?5 "
-        "  AND z            = ?6 ");
-    // clang-format on
-
-    accessedStmt->bind(1, util::now());
-    accessedStmt->bind(2, tile.urlTemplate);
-    accessedStmt->bind(3, tile.pixelRatio);
-    accessedStmt->bind(4, tile.x);
-    accessedStmt->bind(5, tile.y);
-    accessedStmt->bind(6, tile.z);
-    accessedStmt->run();
-
     // clang-format off
     Statement stmt = getStatement(
         //        0      1           2,            3,      4,      5
@@ -604,6 +764,40 @@ OfflineRegionMetadata OfflineDatabase::updateMetadata(const int64_t regionID, co
 }
 
 void OfflineDatabase::deleteRegion(OfflineRegion&& region) {
+    mapbox::sqlite::Transaction transaction(*db, mapbox::sqlite::Transaction::Immediate);
+
+    // Resources and tiles that no other region uses return to the ambient cache.
+
+    // clang-format off
+    Statement resourcesStmt = getStatement(
+        "UPDATE resources "
+        "SET region_owned = 0 "
+        "WHERE id IN (SELECT resource_id FROM region_resources WHERE region_id = ?1) "
+        "  AND NOT EXISTS ( "
+        "    SELECT 1 FROM region_resources "
+        "    WHERE resource_id = resources.id "
+        "      AND region_id  != ?1 "
+        "  ) ");
+    // clang-format on
+
+    resourcesStmt->bind(1, region.getID());
+    resourcesStmt->run();
+
+    // clang-format off
+    Statement tilesStmt = getStatement(
+        "UPDATE tiles "
+        "SET region_owned = 0 "
+        "WHERE id IN (SELECT tile_id FROM region_tiles WHERE region_id = ?1) "
+        "  AND NOT EXISTS ( "
+        "    SELECT 1 FROM region_tiles "
+        "    WHERE tile_id    = tiles.id "
+        "      AND region_id != ?1 "
+        "  ) ");
+    // clang-format on
+
+    tilesStmt->bind(1, region.getID());
+    tilesStmt->run();
+
     // clang-format off
     Statement stmt = getStatement(
         "DELETE FROM regions WHERE id = ?");
@@ -612,11 +806,16 @@ void OfflineDatabase::deleteRegion(OfflineRegion&& region) {
     stmt->bind(1, region.getID());
     stmt->run();
 
-    evict(0);
-    db->exec("PRAGMA incremental_vacuum");
+    transaction.commit();
 
-    // Ensure that the cached offlineTileCount value is recalculated.
+    // Ensure that the cached ambient cache size and offlineTileCount values are recalculated.
+    ambientCacheSize = {};
     offlineMapboxTileCount = {};
+
+    if (needsEviction()) {
+        evict();
+    }
+    db->exec("PRAGMA incremental_vacuum");
 }
 
 optional<std::pair<Response, uint64_t>> OfflineDatabase::getRegionResource(int64_t regionID, const Resource& resource) {
@@ -654,6 +853,8 @@ uint64_t OfflineDatabase::putRegionResource(int64_t regionID, const Resource& re
 }
 
 bool OfflineDatabase::markUsed(int64_t regionID, const Resource& resource) {
+    bool previouslyUnused;
+
     if (resource.kind == Resource::Kind::Tile) {
         // clang-format off
         Statement insert = getStatement(
@@ -681,25 +882,24 @@ bool OfflineDatabase::markUsed(int64_t regionID, const Resource& resource) {
         }
 
         // clang-format off
-        Statement select = getStatement(
-            "SELECT region_id "
-            "FROM region_tiles, tiles "
-            "WHERE region_id   != ?1 "
-            "  AND url_template = ?2 "
-            "  AND pixel_ratio  = ?3 "
-            "  AND x            = ?4 "
-            "  AND y            = ?5 "
-            "  AND z            = ?6 "
-            "LIMIT 1 ");
+        Statement update = getStatement(
+            "UPDATE tiles "
+            "SET region_owned   = 1 "
+            "WHERE url_template = ?1 "
+            "  AND pixel_ratio  = ?2 "
+            "  AND x            = ?3 "
+            "  AND y            = ?4 "
+            "  AND z            = ?5 "
+            "  AND region_owned = 0 ");
         // clang-format on
 
-        select->bind(1, regionID);
-        select->bind(2, tile.urlTemplate);
-        select->bind(3, tile.pixelRatio);
-        select->bind(4, tile.x);
-        select->bind(5, tile.y);
-        select->bind(6, tile.z);
-        return !select->run();
+        update->bind(1, tile.urlTemplate);
+        update->bind(2, tile.pixelRatio);
+        update->bind(3, tile.x);
+        update->bind(4, tile.y);
+        update->bind(5, tile.z);
+        update->run();
+        previouslyUnused = update->changes() != 0;
     } else {
         // clang-format off
         Statement insert = getStatement(
@@ -718,18 +918,25 @@ bool OfflineDatabase::markUsed(int64_t regionID, const Resource& resource) {
         }
 
         // clang-format off
-        Statement select = getStatement(
-            "SELECT region_id "
-            "FROM region_resources, resources "
-            "WHERE region_id    != ?1 "
-            "  AND resources.url = ?2 "
-            "LIMIT 1 ");
+        Statement update = getStatement(
+            "UPDATE resources "
+            "SET region_owned   = 1 "
+            "WHERE url          = ?1 "
+            "  AND region_owned = 0 ");
         // clang-format on
 
-        select->bind(1, regionID);
-        select->bind(2, resource.url);
-        return !select->run();
+        update->bind(1, resource.url);
+        update->run();
+        previouslyUnused = update->changes() != 0;
+    }
+
+    // The resource no longer counts towards the ambient cache.
+    if (previouslyUnused && ambientCacheSize) {
+        auto stored = getStoredSize(resource);
+        *ambientCacheSize -= std::min(*ambientCacheSize, stored ? stored->first : 0);
     }
+
+    return previouslyUnused;
 }
 
 OfflineRegionDefinition OfflineDatabase::getRegionDefinition(int64_t regionID) {
@@ -791,91 +998,115 @@ T OfflineDatabase::getPragma(const char * sql) {
     return stmt->get<T>(0);
 }
 
-// Remove least-recently used resources and tiles until the used database size,
-// as calculated by multiplying the number of in-use pages by the page size, is
-// less than the maximum cache size. Returns false if this condition cannot be
-// satisfied.
-//
-// SQLite database never shrinks in size unless we call VACCUM. We here
-// are monitoring the soft limit (i.e. number of free pages in the file)
-// and as it approaches to the hard limit (i.e. the actual file size) we
-// delete an arbitrary number of old cache entries. The free pages approach saves
-// us from calling VACCUM or keeping a running total, which can be costly.
-bool OfflineDatabase::evict(uint64_t neededFreeSize) {
-    uint64_t pageSize = getPragma<int64_t>("PRAGMA page_size");
-    uint64_t pageCount = getPragma<int64_t>("PRAGMA page_count");
-
-    auto usedSize = [&] {
-        return pageSize * (pageCount - getPragma<int64_t>("PRAGMA freelist_count"));
-    };
+uint64_t OfflineDatabase::getAmbientCacheSize() {
+    // Like the offline Mapbox tile count, this is calculated once and then kept up to date by the
+    // statements that change it, since summing it up involves a scan of all ambient resources.
 
+    if (ambientCacheSize) {
+        return *ambientCacheSize;
+    }
+
+    // clang-format off
+    Statement stmt = getStatement(
+        "SELECT (SELECT IFNULL(SUM(length(data)), 0) FROM resources WHERE region_owned = 0) "
+        "     + (SELECT IFNULL(SUM(length(data)), 0) FROM tiles     WHERE region_owned = 0) ");
+    // clang-format on
+
+    stmt->run();
+
+    ambientCacheSize = stmt->get<int64_t>(0);
+    return *ambientCacheSize;
+}
+
+bool OfflineDatabase::needsEviction() {
     // The addition of pageSize is a fudge factor to account for non `data` column
     // size, and because pages can get fragmented on the database.
-    while (usedSize() + neededFreeSize + pageSize > maximumCacheSize) {
+    return getAmbientCacheSize() + getPragma<int64_t>("PRAGMA page_size") > maximumCacheSize;
+}
+
+// Remove least-recently used resources and tiles that no region uses until the ambient cache
+// is a tenth below the maximum cache size, so that eviction runs once for every tenth of the
+// cache that gets written rather than on every put.
+//
+// Freed pages are reused by later puts; SQLite database never shrinks in size unless we call
+// VACUUM, which we only do incrementally after deleting a region.
+void OfflineDatabase::evict() {
+    while (evictBatch()) {
+    }
+}
+
+bool OfflineDatabase::evictBatch() {
+    const uint64_t pageSize = getPragma<int64_t>("PRAGMA page_size");
+    const uint64_t targetSize = maximumCacheSize - maximumCacheSize / 10;
+
+    // Eviction picks the least recently used entries, so pending access times must be written.
+    flushAccessTimes();
+
+    mapbox::sqlite::Transaction transaction(*db, mapbox::sqlite::Transaction::Immediate);
+
+    uint64_t size = getAmbientCacheSize();
+    if (size + pageSize <= targetSize) {
+        return false;
+    }
+
+    std::vector<int64_t> resourceIDs;
+    std::vector<int64_t> tileIDs;
+
+    {
         // clang-format off
-        Statement accessedStmt = getStatement(
-            "SELECT max(accessed) "
-            "FROM ( "
-            "    SELECT accessed "
+        Statement stmt = getStatement(
+            "    SELECT 0, id, length(data), accessed "
             "    FROM resources "
-            "    LEFT JOIN region_resources "
-            "    ON resource_id = resources.id "
-            "    WHERE resource_id IS NULL "
+            "    WHERE region_owned = 0 "
             "  UNION ALL "
-            "    SELECT accessed "
+            "    SELECT 1, id, length(data), accessed "
             "    FROM tiles "
-            "    LEFT JOIN region_tiles "
-            "    ON tile_id = tiles.id "
-            "    WHERE tile_id IS NULL "
-            "  ORDER BY accessed ASC LIMIT ?1 "
-            ") "
-        );
-        accessedStmt->bind(1, 50);
+            "    WHERE region_owned = 0 "
+            "  ORDER BY accessed ASC LIMIT ?1 ");
         // clang-format on
-        if (!accessedStmt->run()) {
-            return false;
+
+        stmt->bind(1, evictionBatchSize);
+        while (size + pageSize > targetSize && stmt->run()) {
+            (stmt->get<bool>(0) ? tileIDs : resourceIDs).push_back(stmt->get<int64_t>(1));
+            size -= std::min<uint64_t>(size, stmt->get<optional<int64_t>>(2).value_or(0));
         }
-        Timestamp accessed = accessedStmt->get<Timestamp>(0);
+    }
 
-        // clang-format off
-        Statement stmt1 = getStatement(
-            "DELETE FROM resources "
-            "WHERE id IN ( "
-            "  SELECT id FROM resources "
-            "  LEFT JOIN region_resources "
-            "  ON resource_id = resources.id "
-            "  WHERE resource_id IS NULL "
-            "  AND accessed <= ?1 "
-            ") ");
-        // clang-format on
-        stmt1->bind(1, accessed);
-        stmt1->run();
-        uint64_t changes1 = stmt1->changes();
+    if (resourceIDs.empty() && tileIDs.empty()) {
+        // Nothing left to evict.
+        ambientCacheSize = 0;
+        return false;
+    }
 
-        // clang-format off
-        Statement stmt2 = getStatement(
-            "DELETE FROM tiles "
-            "WHERE id IN ( "
-            "  SELECT id FROM tiles "
-            "  LEFT JOIN region_tiles "
-            "  ON tile_id = tiles.id "
-            "  WHERE tile_id IS NULL "
-            "  AND accessed <= ?1 "
-            ") ");
-        // clang-format on
-        stmt2->bind(1, accessed);
-        stmt2->run();
-        uint64_t changes2 = stmt2->changes();
+    // clang-format off
+    Statement deleteResource = getStatement(
+        "DELETE FROM resources WHERE id = ?1");
+    // clang-format on
 
-        // The cached value of offlineTileCount does not need to be updated
-        // here because only non-offline tiles can be removed by eviction.
+    for (int64_t id : resourceIDs) {
+        deleteResource->bind(1, id);
+        deleteResource->run();
+        deleteResource->reset();
+    }
 
-        if (changes1 == 0 && changes2 == 0) {
-            return false;
-        }
+    // clang-format off
+    Statement deleteTile = getStatement(
+        "DELETE FROM tiles WHERE id = ?1");
+    // clang-format on
+
+    for (int64_t id : tileIDs) {
+        deleteTile->bind(1, id);
+        deleteTile->run();
+        deleteTile->reset();
     }
 
-    return true;
+    // The cached value of offlineTileCount does not need to be updated
+    // here because only non-offline tiles can be removed by eviction.
+
+    transaction.commit();
+
+    ambientCacheSize = size;
+    return size + pageSize > targetSize;
 }
 
 void OfflineDatabase::setOfflineMapboxTileCountLimit(uint64_t limit) {
@@ -7,9 +7,11 @@
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/mapbox.hpp>
 
+#include <map>
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <tuple>
 
 namespace mapbox {
 namespace sqlite {
@@ -25,16 +27,41 @@ class TileID;
 
 class OfflineDatabase : private util::noncopyable {
 public:
+    enum class Access : bool {
+        ReadWrite,
+        // Opens an additional connection to a database that was created by a ReadWrite instance.
+        // Only get() may be used; it doesn't record access times, so hits must be reported to
+        // the ReadWrite instance with markAccessed().
+        ReadOnly,
+    };
+
     // Limits affect ambient caching (put) only; resources required by offline
-    // regions are exempt.
-    OfflineDatabase(std::string path, uint64_t maximumCacheSize = util::DEFAULT_MAX_CACHE_SIZE);
+    // regions are exempt. put() doesn't evict by itself, so that writes don't stall
+    // on it; evict() should be called when needsEviction() returns true, e.g. once
+    // pending requests have been handled.
+    OfflineDatabase(std::string path,
+                    uint64_t maximumCacheSize = util::DEFAULT_MAX_CACHE_SIZE,
+                    Access = Access::ReadWrite);
     ~OfflineDatabase();
 
     optional<Response> get(const Resource&);
 
+    // Bumps the access time used for evicting least recently used ambient resources. Access
+    // times are collected in memory and written in a single transaction once a minute, before
+    // evicting, and on destruction.
+    void markAccessed(const Resource&);
+    void flushAccessTimes();
+
     // Return value is (inserted, stored size)
     std::pair<bool, uint64_t> put(const Resource&, const Response&);
 
+    bool needsEviction();
+    void evict();
+
+    // Evicts a single batch of entries in its own transaction, and returns whether more batches
+    // are needed. Callers can handle other requests in between batches.
+    bool evictBatch();
+
     std::vector<OfflineRegion> listRegions();
 
     OfflineRegion createRegion(const OfflineRegionDefinition&,
@@ -65,6 +92,8 @@ private:
     void migrateToVersion3();
     void migrateToVersion5();
     void migrateToVersion6();
+    void migrateToVersion7();
+    void migrateToVersion8();
 
     class Statement {
     public:
@@ -93,7 +122,10 @@ private:
 
     optional<std::pair<Response, uint64_t>> getInternal(const Resource&);
     optional<int64_t> hasInternal(const Resource&);
-    std::pair<bool, uint64_t> putInternal(const Resource&, const Response&, bool evict);
+    std::pair<bool, uint64_t> putInternal(const Resource&, const Response&, bool ambient);
+
+    // Stored data size, and whether any region uses the resource, if it is in the database.
+    optional<std::pair<uint64_t, bool>> getStoredSize(const Resource&);
 
     // Return value is true iff the resource was previously unused by any other regions.
     bool markUsed(int64_t regionID, const Resource&);
@@ -102,6 +134,7 @@ private:
     std::pair<int64_t, int64_t> getCompletedTileCountAndSize(int64_t regionID);
 
     const std::string path;
+    const Access access;
     std::unique_ptr<::mapbox::sqlite::Database> db;
     std::unordered_map<const char *, std::unique_ptr<::mapbox::sqlite::Statement>> statements;
 
@@ -113,7 +146,14 @@ private:
     uint64_t offlineMapboxTileCountLimit = util::mapbox::DEFAULT_OFFLINE_TILE_COUNT_LIMIT;
     optional<uint64_t> offlineMapboxTileCount;
 
-    bool evict(uint64_t neededFreeSize);
+    // Size of the data of resources that no region uses, which is what maximumCacheSize limits.
+    uint64_t getAmbientCacheSize();
+    optional<uint64_t> ambientCacheSize;
+
+    using TileKey = std::tuple<std::string, uint8_t, int32_t, int32_t, int8_t>;
+    std::map<TileKey, Timestamp> accessedTiles;
+    std::unordered_map<std::string, Timestamp> accessedResources;
+    Timestamp lastAccessTimesFlush;
 };
 
 } // namespace mbgl
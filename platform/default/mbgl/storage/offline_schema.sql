@@ -9,6 +9,7 @@ CREATE TABLE resources (                   -- Generic table for style, source, s
   compressed INTEGER NOT NULL DEFAULT 0,
   accessed INTEGER NOT NULL,
   must_revalidate INTEGER NOT NULL DEFAULT 0,
+  region_owned INTEGER NOT NULL DEFAULT 0,  -- Set while any region uses the resource, exempting it from eviction.
   UNIQUE (url)
 );
 
@@ -26,6 +27,7 @@ CREATE TABLE tiles (
   compressed INTEGER NOT NULL DEFAULT 0,
   accessed INTEGER NOT NULL,
   must_revalidate INTEGER NOT NULL DEFAULT 0,
+  region_owned INTEGER NOT NULL DEFAULT 0,
   UNIQUE (url_template, pixel_ratio, z, x, y)
 );
 
@@ -51,11 +53,11 @@ CREATE TABLE region_tiles (
 
 -- Indexes for efficient eviction queries
 
-CREATE INDEX resources_accessed
-ON resources (accessed);
+CREATE INDEX resources_region_owned_accessed
+ON resources (region_owned, accessed);
 
-CREATE INDEX tiles_accessed
-ON tiles (accessed);
+CREATE INDEX tiles_region_owned_accessed
+ON tiles (region_owned, accessed);
 
 CREATE INDEX region_resources_resource_id
 ON region_resources (resource_id);
@@ -0,0 +1,95 @@
+#include <mbgl/storage/response_cache.hpp>
+#include <mbgl/storage/resource.hpp>
+
+#include <functional>
+#include <iterator>
+
+namespace mbgl {
+
+namespace {
+
+// Accounts for the entry itself and its bookkeeping, so that many small responses can't grow the
+// cache far beyond its limit.
+constexpr uint64_t entryOverhead = 256;
+
+bool isFresh(const Response& response) {
+    return !response.expires || *response.expires > util::now();
+}
+
+} // namespace
+
+ResponseCache::ResponseCache(uint64_t maximumSize)
+    : maximumShardSize(maximumSize / shardCount) {
+}
+
+ResponseCache::Shard& ResponseCache::shardFor(const std::string& url) {
+    return shards[std::hash<std::string>()(url) % shardCount];
+}
+
+void ResponseCache::erase(Shard& shard, std::list<Entry>::iterator it) {
+    shard.size -= it->size;
+    shard.index.erase(it->url);
+    shard.entries.erase(it);
+}
+
+optional<Response> ResponseCache::get(const Resource& resource) {
+    Shard& shard = shardFor(resource.url);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(resource.url);
+    if (it == shard.index.end()) {
+        missCount++;
+        return {};
+    }
+
+    if (!isFresh(it->second->response)) {
+        erase(shard, it->second);
+        missCount++;
+        return {};
+    }
+
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    hitCount++;
+    return it->second->response;
+}
+
+void ResponseCache::put(const Resource& resource, const Response& response) {
+    if (response.error || response.notModified || !isFresh(response)) {
+        remove(resource);
+        return;
+    }
+
+    const uint64_t size = entryOverhead + resource.url.size() + (response.data ? response.data->size() : 0);
+
+    Shard& shard = shardFor(resource.url);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(resource.url);
+    if (it != shard.index.end()) {
+        erase(shard, it->second);
+    }
+
+    if (size > maximumShardSize) {
+        return;
+    }
+
+    while (shard.size + size > maximumShardSize) {
+        erase(shard, std::prev(shard.entries.end()));
+    }
+
+    shard.entries.push_front({ resource.url, response, size });
+    shard.index.emplace(resource.url, shard.entries.begin());
+    shard.size += size;
+}
+
+void ResponseCache::remove(const Resource& resource) {
+    Shard& shard = shardFor(resource.url);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.index.find(resource.url);
+    if (it != shard.index.end()) {
+        erase(shard, it->second);
+    }
+}
+
+} // namespace mbgl
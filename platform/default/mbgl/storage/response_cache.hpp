@@ -0,0 +1,64 @@
+#pragma once
+
+#include <mbgl/storage/response.hpp>
+#include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace mbgl {
+
+class Resource;
+
+// Keeps recently used responses from the offline database in memory, so that repeated requests
+// for the same resources don't read and decompress them again. Responses share their data with
+// the requests they are handed to. Only fresh responses are served; once a response expires, it
+// is dropped so that the request goes through the database and revalidation as usual.
+//
+// The cache is split into shards with their own lock and size limit, and may be used from any
+// thread.
+class ResponseCache : private util::noncopyable {
+public:
+    explicit ResponseCache(uint64_t maximumSize);
+
+    optional<Response> get(const Resource&);
+    void put(const Resource&, const Response&);
+    void remove(const Resource&);
+
+    uint64_t hits() const { return hitCount; }
+    uint64_t misses() const { return missCount; }
+
+private:
+    struct Entry {
+        std::string url;
+        Response response;
+        uint64_t size;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        // Most recently used entries first.
+        std::list<Entry> entries;
+        std::unordered_map<std::string, std::list<Entry>::iterator> index;
+        uint64_t size = 0;
+    };
+
+    static constexpr std::size_t shardCount = 8;
+
+    Shard& shardFor(const std::string& url);
+    static void erase(Shard&, std::list<Entry>::iterator);
+
+    const uint64_t maximumShardSize;
+    std::array<Shard, shardCount> shards;
+
+    std::atomic<uint64_t> hitCount { 0 };
+    std::atomic<uint64_t> missCount { 0 };
+};
+
+} // namespace mbgl
@@ -15,13 +15,18 @@
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/timer.hpp>
+#include <mbgl/util/url.hpp>
 #include <mbgl/util/http_timeout.hpp>
+#include <mbgl/util/string.hpp>
 
 #include <algorithm>
 #include <cassert>
-#include <list>
+#include <set>
+#include <tuple>
 #include <unordered_set>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace mbgl {
 
@@ -40,9 +45,10 @@ public:
     void setTransformedURL(const std::string&& url);
     ActorRef<OnlineFileRequest> actor();
 
+    void setPriority(int32_t) override;
+
     OnlineFileSource::Impl& impl;
     Resource resource;
-    std::unique_ptr<AsyncRequest> request;
     util::Timer timer;
     Callback callback;
 
@@ -58,6 +64,29 @@ public:
     uint32_t failedRequests = 0;
     Response::Error::Reason failedRequestReason = Response::Error::Reason::Success;
     optional<Timestamp> retryAfter;
+
+    // Orders pending requests that are otherwise equal by the time they were queued.
+    uint64_t queueOrder = 0;
+
+    // The slot whose queue holds the request while it's pending.
+    std::string pendingSlot;
+};
+
+// Pending requests are activated in this order: required before optional requests, resources
+// that tiles depend on (styles, sources, sprites, glyphs) before tiles, higher priorities before
+// lower ones, and finally in the order they were queued.
+struct PendingRequestOrder {
+    bool operator()(const OnlineFileRequest* a, const OnlineFileRequest* b) const {
+        return key(a) < key(b);
+    }
+
+    static std::tuple<bool, bool, int64_t, uint64_t> key(const OnlineFileRequest* request) {
+        const Resource& resource = request->resource;
+        return std::make_tuple(resource.necessity == Resource::Optional,
+                               resource.kind == Resource::Kind::Tile,
+                               -int64_t(resource.priority),
+                               request->queueOrder);
+    }
 };
 
 class OnlineFileSource::Impl {
@@ -86,65 +115,159 @@ public:
 
     void remove(OnlineFileRequest* request) {
         allRequests.erase(request);
+        if (completingRequests) {
+            std::replace(completingRequests->begin(), completingRequests->end(), request,
+                         static_cast<OnlineFileRequest*>(nullptr));
+        }
         if (activeRequests.erase(request)) {
-            activatePendingRequest();
-        } else {
-            auto it = pendingRequestsMap.find(request);
-            if (it != pendingRequestsMap.end()) {
-                pendingRequestsList.erase(it->second);
-                pendingRequestsMap.erase(it);
+            // The transfer is only cancelled once none of the requests sharing it remain.
+            auto it = transfers.find(transferKey(request->resource));
+            assert(it != transfers.end());
+            auto& requests = it->second.requests;
+            requests.erase(std::find(requests.begin(), requests.end(), request));
+            if (requests.empty()) {
+                const std::string slot = it->second.slot;
+                releaseSlot(slot);
+                transfers.erase(it);
+                activatePendingRequests(slot);
             }
+        } else {
+            unqueueRequest(request);
+        }
+    }
+
+    void setPriority(OnlineFileRequest* request, int32_t priority) {
+        // The priority is part of the pending queue's order, so requests are taken out while
+        // it changes.
+        const bool pending = unqueueRequest(request);
+        request->resource.priority = priority;
+        if (pending) {
+            pendingRequests[request->pendingSlot].insert(request);
         }
-        assert(pendingRequestsMap.size() == pendingRequestsList.size());
     }
 
     void activateOrQueueRequest(OnlineFileRequest* request) {
         assert(allRequests.find(request) != allRequests.end());
         assert(activeRequests.find(request) == activeRequests.end());
-        assert(!request->request);
 
-        if (activeRequests.size() >= HTTPFileSource::maximumConcurrentRequests()) {
-            queueRequest(request);
+        // Joining a transfer that is already in progress doesn't take up another slot.
+        if (transfers.find(transferKey(request->resource)) != transfers.end()) {
+            activateRequest(request, {});
+            return;
+        }
+
+        const Slot slot = slotFor(request->resource);
+        if (isFull(slot)) {
+            queueRequest(request, slot.first);
         } else {
-            activateRequest(request);
+            activateRequest(request, slot.first);
         }
     }
 
-    void queueRequest(OnlineFileRequest* request) {
-        auto it = pendingRequestsList.insert(pendingRequestsList.end(), request);
-        pendingRequestsMap.emplace(request, std::move(it));
-        assert(pendingRequestsMap.size() == pendingRequestsList.size());
+    void queueRequest(OnlineFileRequest* request, const std::string& slot) {
+        request->queueOrder = nextQueueOrder++;
+        request->pendingSlot = slot;
+        pendingRequests[slot].insert(request);
     }
 
-    void activateRequest(OnlineFileRequest* request) {
+    // Returns whether the request was pending.
+    bool unqueueRequest(OnlineFileRequest* request) {
+        auto it = pendingRequests.find(request->pendingSlot);
+        if (it == pendingRequests.end() || !it->second.erase(request)) {
+            return false;
+        }
+        if (it->second.empty()) {
+            pendingRequests.erase(it);
+        }
+        return true;
+    }
+
+    // The slot is only taken if the request starts a new transfer.
+    void activateRequest(OnlineFileRequest* request, const std::string& slot) {
         activeRequests.insert(request);
-        request->request = httpFileSource.request(request->resource, [=] (Response response) {
-            activeRequests.erase(request);
-            activatePendingRequest();
-            request->request.reset();
-            request->completed(response);
+
+        std::string key = transferKey(request->resource);
+        auto it = transfers.find(key);
+        if (it != transfers.end()) {
+            it->second.requests.push_back(request);
+            return;
+        }
+
+        Transfer& transfer = transfers[key];
+        transfer.requests.push_back(request);
+        transfer.slot = slot;
+        slotTransfers[slot]++;
+        transfer.request = httpFileSource.request(request->resource, [this, key] (Response response) {
+            transferCompleted(key, response);
         });
-        assert(pendingRequestsMap.size() == pendingRequestsList.size());
     }
 
-    void activatePendingRequest() {
-        if (pendingRequestsList.empty()) {
-            return;
+    void transferCompleted(const std::string& key, const Response& response) {
+        auto it = transfers.find(key);
+        assert(it != transfers.end());
+
+        std::vector<OnlineFileRequest*> requests = std::move(it->second.requests);
+        const std::string slot = it->second.slot;
+        releaseSlot(slot);
+        transfers.erase(it);
+
+        for (auto request : requests) {
+            activeRequests.erase(request);
+        }
+        activatePendingRequests(slot);
+
+        // Completing a request may delete other requests sharing the response; remove() clears
+        // them from this list so that they're skipped.
+        auto previouslyCompleting = completingRequests;
+        completingRequests = &requests;
+        for (auto& request : requests) {
+            if (request) {
+                request->completed(response);
+            }
         }
+        completingRequests = previouslyCompleting;
+    }
 
-        OnlineFileRequest* request = pendingRequestsList.front();
-        pendingRequestsList.pop_front();
+    // Activates the requests queued for a slot that was released, in order, until the slot is full
+    // again. Requests queued for other slots aren't looked at, so that activation doesn't slow down
+    // with the number of pending requests.
+    void activatePendingRequests(const std::string& releasedSlot) {
+        auto queue = pendingRequests.find(releasedSlot);
+        while (queue != pendingRequests.end() && !queue->second.empty()) {
+            OnlineFileRequest* request = *queue->second.begin();
+
+            // Requests that join a transfer in progress don't take up a slot.
+            if (transfers.find(transferKey(request->resource)) != transfers.end()) {
+                queue->second.erase(queue->second.begin());
+                activateRequest(request, {});
+                continue;
+            }
 
-        pendingRequestsMap.erase(request);
+            const Slot slot = slotFor(request->resource);
+            if (!isFull(slot)) {
+                queue->second.erase(queue->second.begin());
+                activateRequest(request, slot.first);
+            } else if (slot.first == releasedSlot) {
+                break;
+            } else {
+                // The origin started or stopped multiplexing since the request was queued. Move
+                // the request to the queue of the slot it takes now, keeping its place in line.
+                queue->second.erase(queue->second.begin());
+                request->pendingSlot = slot.first;
+                pendingRequests[slot.first].insert(request);
+                queue = pendingRequests.find(releasedSlot);
+            }
+        }
 
-        activateRequest(request);
-        assert(pendingRequestsMap.size() == pendingRequestsList.size());
+        if (queue != pendingRequests.end() && queue->second.empty()) {
+            pendingRequests.erase(queue);
+        }
     }
 
     bool isPending(OnlineFileRequest* request) {
-        return pendingRequestsMap.find(request) != pendingRequestsMap.end();
+        auto it = pendingRequests.find(request->pendingSlot);
+        return it != pendingRequests.end() && it->second.find(request) != it->second.end();
     }
-
     bool isActive(OnlineFileRequest* request) {
         return activeRequests.find(request) != activeRequests.end();
     }
@@ -153,7 +276,52 @@ public:
         resourceTransform = std::move(transform);
     }
 
+    void setMaximumConnectionsPerHost(uint32_t maximum) {
+        httpFileSource.setMaximumConnectionsPerHost(maximum);
+    }
+
 private:
+    // A slot and the number of transfers it allows.
+    using Slot = std::pair<std::string, uint32_t>;
+
+    // Transfers to an origin whose responses are multiplexed over a shared connection take one of
+    // that origin's slots, which are keyed by the origin. All other transfers share the
+    // HTTPFileSource::maximumConcurrentRequests() slots keyed by the empty string. Returns the
+    // slot a new transfer for the resource takes.
+    Slot slotFor(const Resource& resource) const {
+        if (uint32_t limit = httpFileSource.multiplexedRequestLimit(resource.url)) {
+            return { util::origin(resource.url), limit };
+        }
+        return { std::string(), HTTPFileSource::maximumConcurrentRequests() };
+    }
+
+    bool isFull(const Slot& slot) const {
+        auto it = slotTransfers.find(slot.first);
+        return it != slotTransfers.end() && it->second >= slot.second;
+    }
+
+    void releaseSlot(const std::string& slot) {
+        auto it = slotTransfers.find(slot);
+        assert(it != slotTransfers.end());
+        if (--it->second == 0) {
+            slotTransfers.erase(it);
+        }
+    }
+
+    // Requests for the same URL with the same validators share a single HTTP transfer.
+    static std::string transferKey(const Resource& resource) {
+        std::string key = resource.url;
+        key += '\n';
+        if (resource.priorEtag) {
+            key += *resource.priorEtag;
+        }
+        key += '\n';
+        if (resource.priorModified) {
+            key += util::toString(resource.priorModified->time_since_epoch().count());
+        }
+        return key;
+    }
+
     void networkIsReachableAgain() {
         for (auto& request : allRequests) {
             request->networkIsReachableAgain();
@@ -170,14 +338,25 @@ private:
      * 3. Active (open network connection)
      * 4. Back to #1
      *
-     * Requests in any state are in `allRequests`. Requests in the pending state are in
-     * `pendingRequests`. Requests in the active state are in `activeRequests`.
+     * Requests in any state are in `allRequests`. Requests in the pending state are queued in
+     * `pendingRequests`, by the slot they wait for. Requests in the active state are in `activeRequests`, and share a
+     * transfer in `transfers` with the other active requests for the same resource. The number
+     * of transfers is limited per slot, see `slotFor()`.
      */
     std::unordered_set<OnlineFileRequest*> allRequests;
-    std::list<OnlineFileRequest*> pendingRequestsList;
-    std::unordered_map<OnlineFileRequest*, std::list<OnlineFileRequest*>::iterator> pendingRequestsMap;
+    std::unordered_map<std::string, std::set<OnlineFileRequest*, PendingRequestOrder>> pendingRequests;
+    uint64_t nextQueueOrder = 0;
     std::unordered_set<OnlineFileRequest*> activeRequests;
 
+    struct Transfer {
+        std::unique_ptr<AsyncRequest> request;
+        std::vector<OnlineFileRequest*> requests;
+        std::string slot;
+    };
+    std::unordered_map<std::string, Transfer> transfers;
+    std::unordered_map<std::string, uint32_t> slotTransfers;
+    std::vector<OnlineFileRequest*>* completingRequests = nullptr;
+
     HTTPFileSource httpFileSource;
     util::AsyncTask reachability { std::bind(&Impl::networkIsReachableAgain, this) };
 };
@@ -225,6 +404,10 @@ void OnlineFileSource::setResourceTransform(optional<ActorRef<ResourceTransform>
     impl->setResourceTransform(std::move(transform));
 }
 
+void OnlineFileSource::setMaximumConnectionsPerHost(uint32_t maximum) {
+    impl->setMaximumConnectionsPerHost(maximum);
+}
+
 OnlineFileRequest::OnlineFileRequest(Resource resource_, Callback callback_, OnlineFileSource::Impl& impl_)
     : impl(impl_),
       resource(std::move(resource_)),
@@ -379,6 +562,10 @@ void OnlineFileRequest::setTransformedURL(const std::string&& url) {
      schedule();
 }
 
+void OnlineFileRequest::setPriority(int32_t priority) {
+    impl.setPriority(this, priority);
+}
+
 ActorRef<OnlineFileRequest> OnlineFileRequest::actor() {
     if (!mailbox) {
         // Lazy constructed because this can be costly and
@@ -1,4 +1,5 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_decoder.hpp>
 #include <mbgl/util/premultiply.hpp>
 #include <mbgl/util/char_array_buffer.hpp>
 #include <mbgl/util/logging.hpp>
@@ -62,7 +63,7 @@ struct png_struct_guard {
     png_infopp i_;
 };
 
-PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
+PremultipliedImage decodePNG(const uint8_t* data, size_t size, const ImageDecodeOptions& options) {
     util::CharArrayBuffer dataBuffer { reinterpret_cast<const char*>(data), size };
     std::istream stream(&dataBuffer);
 
@@ -98,7 +99,10 @@ PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
     int color_type = 0;
     png_get_IHDR(png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, nullptr, nullptr, nullptr);
 
-    UnassociatedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+    // Images without an alpha channel are opaque and don't need to be premultiplied.
+    const bool hasAlpha = (color_type & PNG_COLOR_MASK_ALPHA) || png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS);
+
+    PremultipliedImage image = options.allocate({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
 
     if (color_type == PNG_COLOR_TYPE_PALETTE)
         png_set_expand(png_ptr);
@@ -118,7 +122,8 @@ PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
 
     png_set_add_alpha(png_ptr, 0xff, PNG_FILLER_AFTER);
 
-    if (png_get_interlace_type(png_ptr,info_ptr) == PNG_INTERLACE_ADAM7) {
+    const bool interlaced = png_get_interlace_type(png_ptr, info_ptr) == PNG_INTERLACE_ADAM7;
+    if (interlaced) {
         png_set_interlace_handling(png_ptr); // FIXME: libpng bug?
         // according to docs png_read_image
         // "..automatically handles interlacing,
@@ -127,16 +132,33 @@ PremultipliedImage decodePNG(const uint8_t* data, size_t size) {
 
     png_read_update_info(png_ptr, info_ptr);
 
-    // we can read whole image at once
-    // alloc row pointers
-    const std::unique_ptr<png_bytep[]> rows(new png_bytep[height]);
-    for (unsigned row = 0; row < height; ++row)
-        rows[row] = image.data.get() + row * width * 4;
-    png_read_image(png_ptr, rows.get());
+    const std::size_t stride = image.stride();
+
+    if (interlaced) {
+        // Interlaced images are only complete after the last pass, so we read the whole image
+        // at once and premultiply afterwards.
+        const std::unique_ptr<png_bytep[]> rows(new png_bytep[height]);
+        for (unsigned row = 0; row < height; ++row)
+            rows[row] = image.data.get() + row * stride;
+        png_read_image(png_ptr, rows.get());
+
+        if (hasAlpha) {
+            util::premultiply(image.data.get(), image.bytes());
+        }
+    } else {
+        // Premultiply every row right after decoding it, while it is still in the cache.
+        for (unsigned row = 0; row < height; ++row) {
+            png_bytep rowData = image.data.get() + row * stride;
+            png_read_row(png_ptr, rowData, nullptr);
+            if (hasAlpha) {
+                util::premultiply(rowData, stride);
+            }
+        }
+    }
 
     png_read_end(png_ptr, nullptr);
 
-    return util::premultiply(std::move(image));
+    return image;
 }
 
 } // namespace mbgl
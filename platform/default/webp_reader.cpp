@@ -1,7 +1,9 @@
 #include <mbgl/util/image.hpp>
-#include <mbgl/util/premultiply.hpp>
+#include <mbgl/util/image_decoder.hpp>
 #include <mbgl/util/logging.hpp>
 
+#include <cmath>
+
 extern "C"
 {
 #include <webp/decode.h>
@@ -9,23 +11,47 @@ extern "C"
 
 namespace mbgl {
 
-PremultipliedImage decodeWebP(const uint8_t* data, size_t size) {
-    int width = 0, height = 0;
-    if (WebPGetInfo(data, size, &width, &height) == 0) {
+PremultipliedImage decodeWebP(const uint8_t* data, size_t size, const ImageDecodeOptions& options) {
+    WebPDecoderConfig config;
+    if (!WebPInitDecoderConfig(&config)) {
+        throw std::runtime_error("failed to initialize WebP decoder");
+    }
+
+    if (WebPGetFeatures(data, size, &config.input) != VP8_STATUS_OK) {
         throw std::runtime_error("failed to retrieve WebP basic header information");
     }
 
-    int stride = width * 4;
-    size_t webpSize = stride * height;
-    auto webp = std::make_unique<uint8_t[]>(webpSize);
+    int width = config.input.width;
+    int height = config.input.height;
+
+    // Scale down while decoding when the image is larger than needed, keeping the aspect ratio.
+    const optional<Size>& target = options.targetSize;
+    if (target && !target->isEmpty() &&
+        static_cast<uint32_t>(width) > target->width && static_cast<uint32_t>(height) > target->height) {
+        const double scale = std::max(double(target->width) / width, double(target->height) / height);
+        width = std::ceil(width * scale);
+        height = std::ceil(height * scale);
+        config.options.use_scaling = 1;
+        config.options.scaled_width = width;
+        config.options.scaled_height = height;
+    }
+
+    PremultipliedImage image = options.allocate({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+
+    // Have libwebp premultiply each row as it is emitted, and write straight into our buffer.
+    config.output.colorspace = MODE_rgbA;
+    config.output.is_external_memory = 1;
+    config.output.u.RGBA.rgba = image.data.get();
+    config.output.u.RGBA.stride = static_cast<int>(image.stride());
+    config.output.u.RGBA.size = image.bytes();
 
-    if (!WebPDecodeRGBAInto(data, size, webp.get(), webpSize, stride)) {
+    const VP8StatusCode status = WebPDecode(data, size, &config);
+    WebPFreeDecBuffer(&config.output);
+    if (status != VP8_STATUS_OK) {
         throw std::runtime_error("failed to decode WebP data");
     }
 
-    UnassociatedImage image({ static_cast<uint32_t>(width), static_cast<uint32_t>(height) },
-                            std::move(webp));
-    return util::premultiply(std::move(image));
+    return image;
 }
 
 } // namespace mbgl
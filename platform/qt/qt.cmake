@@ -25,6 +25,8 @@ set(MBGL_QT_FILES
     PRIVATE platform/default/mbgl/storage/offline_database.hpp
     PRIVATE platform/default/mbgl/storage/offline_download.cpp
     PRIVATE platform/default/mbgl/storage/offline_download.hpp
+    PRIVATE platform/default/mbgl/storage/response_cache.cpp
+    PRIVATE platform/default/mbgl/storage/response_cache.hpp
     PRIVATE platform/default/sqlite3.hpp
 
     # Misc
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <memory>
 
 #include <mbgl/text/bidi.hpp>
@@ -15,22 +16,23 @@ std::u16string applyArabicShaping(const std::u16string& input) {
     return input;
 }
 
-void BiDi::mergeParagraphLineBreaks(std::set<std::size_t>& lineBreakPoints) {
-    lineBreakPoints.insert(static_cast<std::size_t>(impl->string.length()));
+void BiDi::mergeParagraphLineBreaks(std::vector<std::size_t>& lineBreakPoints) {
+    const std::size_t end = static_cast<std::size_t>(impl->string.length());
+    if (lineBreakPoints.empty() || lineBreakPoints.back() < end) {
+        lineBreakPoints.push_back(end);
+    }
 }
 
-std::vector<std::u16string>
-BiDi::applyLineBreaking(std::set<std::size_t> lineBreakPoints) {
+void BiDi::applyLineBreaking(std::vector<std::size_t>& lineBreakPoints, std::vector<std::u16string>& lines) {
     mergeParagraphLineBreaks(lineBreakPoints);
 
-    std::vector<std::u16string> transformedLines;
+    lines.resize(lineBreakPoints.size());
+
     std::size_t start = 0;
-    for (std::size_t lineBreakPoint : lineBreakPoints) {
-        transformedLines.push_back(getLine(start, lineBreakPoint));
-        start = lineBreakPoint;
+    for (std::size_t i = 0; i < lineBreakPoints.size(); i++) {
+        getLine(start, lineBreakPoints[i], lines[i]);
+        start = lineBreakPoints[i];
     }
-
-    return transformedLines;
 }
 
 BiDi::BiDi() : impl(std::make_unique<BiDiImpl>())
@@ -39,14 +41,16 @@ BiDi::BiDi() : impl(std::make_unique<BiDiImpl>())
 
 BiDi::~BiDi() = default;
 
-std::vector<std::u16string> BiDi::processText(const std::u16string& input, std::set<std::size_t> lineBreakPoints) {
+void BiDi::processText(const std::u16string& input,
+                       std::vector<std::size_t>& lineBreakPoints,
+                       std::vector<std::u16string>& lines) {
     impl->string = QString::fromUtf16(reinterpret_cast<const ushort*>(input.data()), int(input.size()));
-    return applyLineBreaking(lineBreakPoints);
+    applyLineBreaking(lineBreakPoints, lines);
 }
 
-std::u16string BiDi::getLine(std::size_t start, std::size_t end) {
-    auto utf16 = impl->string.mid(static_cast<int32_t>(start), static_cast<int32_t>(end - start));
-    return std::u16string(reinterpret_cast<const char16_t*>(utf16.utf16()), utf16.length());
+void BiDi::getLine(std::size_t start, std::size_t end, std::u16string& line) {
+    auto utf16 = impl->string.midRef(static_cast<int32_t>(start), static_cast<int32_t>(end - start));
+    line.assign(reinterpret_cast<const char16_t*>(utf16.unicode()), utf16.length());
 }
 
 } // end namespace mbgl
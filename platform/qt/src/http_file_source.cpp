@@ -108,4 +108,12 @@ uint32_t HTTPFileSource::maximumConcurrentRequests() {
 #endif
 }
 
+uint32_t HTTPFileSource::multiplexedRequestLimit(const std::string&) const {
+    return 0;
+}
+
+void HTTPFileSource::setMaximumConnectionsPerHost(uint32_t) {
+    // QNetworkAccessManager uses a fixed number of connections per host.
+}
+
 } // namespace mbgl
@@ -1,8 +1,10 @@
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_decoder.hpp>
 
 #include <QBuffer>
 #include <QByteArray>
 #include <QImage>
+#include <QImageReader>
 
 namespace mbgl {
 
@@ -20,11 +22,15 @@ std::string encodePNG(const PremultipliedImage& pre) {
 }
 
 #if !defined(QT_IMAGE_DECODERS)
-PremultipliedImage decodeJPEG(const uint8_t*, size_t);
-PremultipliedImage decodeWebP(const uint8_t*, size_t);
+PremultipliedImage decodeJPEG(const uint8_t*, size_t, const ImageDecodeOptions&);
+PremultipliedImage decodeWebP(const uint8_t*, size_t, const ImageDecodeOptions&);
 #endif
 
 PremultipliedImage decodeImage(const std::string& string) {
+    return decodeImage(string, {});
+}
+
+PremultipliedImage decodeImage(const std::string& string, const ImageDecodeOptions& options) {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(string.data());
     const size_t size = string.size();
 
@@ -33,20 +39,34 @@ PremultipliedImage decodeImage(const std::string& string) {
         uint32_t riff_magic = (data[0] << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
         uint32_t webp_magic = (data[8] << 24) | (data[9] << 16) | (data[10] << 8) | data[11];
         if (riff_magic == 0x52494646 && webp_magic == 0x57454250) {
-            return decodeWebP(data, size);
+            return decodeWebP(data, size, options);
         }
     }
 
     if (size >= 2) {
         uint16_t magic = ((data[0] << 8) | data[1]) & 0xffff;
         if (magic == 0xFFD8) {
-            return decodeJPEG(data, size);
+            return decodeJPEG(data, size, options);
         }
     }
 #endif
 
+    QByteArray array = QByteArray::fromRawData(reinterpret_cast<const char*>(data), size);
+    QBuffer buffer(&array);
+    QImageReader reader(&buffer);
+
+    // Images larger than the target size are scaled while reading. Some image plugins, such as
+    // the JPEG one, decode at a reduced resolution in that case.
+    const optional<Size>& target = options.targetSize;
+    const QSize imageSize = reader.size();
+    if (target && !target->isEmpty() && imageSize.isValid() &&
+        static_cast<uint32_t>(imageSize.width()) > target->width &&
+        static_cast<uint32_t>(imageSize.height()) > target->height) {
+        reader.setScaledSize(imageSize.scaled(target->width, target->height, Qt::KeepAspectRatioByExpanding));
+    }
+
     QImage image =
-        QImage::fromData(data, size)
+        reader.read()
         .rgbSwapped()
         .convertToFormat(QImage::Format_ARGB32_Premultiplied);
 
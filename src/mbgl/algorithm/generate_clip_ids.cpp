@@ -31,6 +31,10 @@ bool ClipIDGenerator::Leaf::operator==(const Leaf& other) const {
     return children == other.children;
 }
 
+bool ClipIDGenerator::hasOverlappingTiles() const {
+    return overlapping;
+}
+
 std::map<UnwrappedTileID, ClipID> ClipIDGenerator::getClipIDs() const {
     std::map<UnwrappedTileID, ClipID> clipIDs;
 
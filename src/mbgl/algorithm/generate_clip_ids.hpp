@@ -22,6 +22,7 @@ private:
     };
 
     uint8_t bit_offset = 0;
+    bool overlapping = false;
     std::multimap<UnwrappedTileID, Leaf> pool;
 
 public:
@@ -29,6 +30,10 @@ public:
     void update(std::vector<std::reference_wrapper<Renderable>> renderables);
 
     std::map<UnwrappedTileID, ClipID> getClipIDs() const;
+
+    // Whether any of the renderables passed to update() covers another one of the same update,
+    // e.g. a parent tile that is shown in place of a missing child tile.
+    bool hasOverlappingTiles() const;
 };
 
 } // namespace algorithm
@@ -39,6 +39,10 @@ void ClipIDGenerator::update(std::vector<std::reference_wrapper<Renderable>> ren
             }
         }
 
+        if (!leaf.children.empty()) {
+            overlapping = true;
+        }
+
         // Find a leaf with matching children.
         for (auto its = pool.equal_range(renderable.id); its.first != its.second; ++its.first) {
             auto& existing = its.first->second;
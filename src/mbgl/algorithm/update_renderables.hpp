@@ -5,6 +5,7 @@
 #include <mbgl/storage/resource.hpp>
 
 #include <unordered_set>
+#include <algorithm>
 
 namespace mbgl {
 namespace algorithm {
@@ -25,13 +26,22 @@ void updateRenderables(GetTileFn getTile,
     bool covered;
     int32_t overscaledZ;
 
+    // The ideal tiles may have mixed zoom levels when they come from a level-of-detail tile cover.
+    // Tiles of a lower zoom level are loaded with the same amount of overscaling as the most
+    // detailed ideal tiles, which are loaded at dataTileZoom.
+    uint8_t maxIdealZoom = 0;
+    for (const auto& idealRenderTileID : idealTileIDs) {
+        maxIdealZoom = std::max(maxIdealZoom, idealRenderTileID.canonical.z);
+    }
+
     // for (all in the set of ideal tiles of the source) {
     for (const auto& idealRenderTileID : idealTileIDs) {
         assert(idealRenderTileID.canonical.z >= zoomRange.min);
         assert(idealRenderTileID.canonical.z <= zoomRange.max);
-        assert(dataTileZoom >= idealRenderTileID.canonical.z);
+        assert(dataTileZoom >= maxIdealZoom);
 
-        const OverscaledTileID idealDataTileID(dataTileZoom, idealRenderTileID.wrap, idealRenderTileID.canonical);
+        const uint8_t idealDataTileZoom = dataTileZoom - (maxIdealZoom - idealRenderTileID.canonical.z);
+        const OverscaledTileID idealDataTileID(idealDataTileZoom, idealRenderTileID.wrap, idealRenderTileID.canonical);
         auto tile = getTile(idealDataTileID);
         if (!tile) {
             tile = createTile(idealDataTileID);
@@ -50,7 +60,7 @@ void updateRenderables(GetTileFn getTile,
             // The tile isn't loaded yet, but retain it anyway because it's an ideal tile.
             retainTile(*tile, Resource::Necessity::Required);
             covered = true;
-            overscaledZ = dataTileZoom + 1;
+            overscaledZ = idealDataTileZoom + 1;
             if (overscaledZ > zoomRange.max) {
                 // We're looking for an overzoomed child tile.
                 const auto childDataTileID = idealDataTileID.scaledTo(overscaledZ);
@@ -79,7 +89,7 @@ void updateRenderables(GetTileFn getTile,
 
             if (!covered) {
                 // We couldn't find child tiles that entirely cover the ideal tile.
-                for (overscaledZ = dataTileZoom - 1; overscaledZ >= zoomRange.min; --overscaledZ) {
+                for (overscaledZ = idealDataTileZoom - 1; overscaledZ >= zoomRange.min; --overscaledZ) {
                     const auto parentDataTileID = idealDataTileID.scaledTo(overscaledZ);
                     const auto parentRenderTileID = parentDataTileID.toUnwrapped();
 
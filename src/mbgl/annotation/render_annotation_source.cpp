@@ -53,10 +53,14 @@ void RenderAnnotationSource::finishRender(PaintParameters& parameters) {
     tilePyramid.finishRender(parameters);
 }
 
-std::vector<std::reference_wrapper<RenderTile>> RenderAnnotationSource::getRenderTiles() {
+const std::vector<std::reference_wrapper<RenderTile>>& RenderAnnotationSource::getRenderTiles() {
     return tilePyramid.getRenderTiles();
 }
 
+const std::vector<std::reference_wrapper<RenderTile>>& RenderAnnotationSource::getSymbolSortedRenderTiles(float angle) {
+    return tilePyramid.getSymbolSortedRenderTiles(angle);
+}
+
 std::unordered_map<std::string, std::vector<Feature>>
 RenderAnnotationSource::queryRenderedFeatures(const ScreenLineString& geometry,
                                               const TransformState& transformState,
@@ -65,6 +69,14 @@ RenderAnnotationSource::queryRenderedFeatures(const ScreenLineString& geometry,
     return tilePyramid.queryRenderedFeatures(geometry, transformState, style, options);
 }
 
+bool RenderAnnotationSource::queryRenderedFeatures(const ScreenLineString& geometry,
+                                                   const TransformState& transformState,
+                                                   const RenderStyle& style,
+                                                   const RenderedQueryOptions& options,
+                                                   const RenderedFeatureCallback& callback) const {
+    return tilePyramid.queryRenderedFeatures(geometry, transformState, style, options, callback);
+}
+
 std::vector<Feature> RenderAnnotationSource::querySourceFeatures(const SourceQueryOptions&) const {
     return {};
 }
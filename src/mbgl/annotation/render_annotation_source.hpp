@@ -21,7 +21,8 @@ public:
     void startRender(PaintParameters&) final;
     void finishRender(PaintParameters&) final;
 
-    std::vector<std::reference_wrapper<RenderTile>> getRenderTiles() final;
+    const std::vector<std::reference_wrapper<RenderTile>>& getRenderTiles() final;
+    const std::vector<std::reference_wrapper<RenderTile>>& getSymbolSortedRenderTiles(float angle) final;
 
     std::unordered_map<std::string, std::vector<Feature>>
     queryRenderedFeatures(const ScreenLineString& geometry,
@@ -29,6 +30,12 @@ public:
                           const RenderStyle& style,
                           const RenderedQueryOptions& options) const final;
 
+    bool queryRenderedFeatures(const ScreenLineString& geometry,
+                               const TransformState& transformState,
+                               const RenderStyle& style,
+                               const RenderedQueryOptions& options,
+                               const RenderedFeatureCallback& callback) const final;
+
     std::vector<Feature>
     querySourceFeatures(const SourceQueryOptions&) const final;
 
@@ -83,8 +83,8 @@ static int16_t getAdditionalQueryRadius(const RenderedQueryOptions& queryOptions
     return std::min<int16_t>(util::EXTENT, additionalRadius);
 }
 
-void FeatureIndex::query(
-        std::unordered_map<std::string, std::vector<Feature>>& result,
+bool FeatureIndex::query(
+        const RenderedFeatureCallback& callback,
         const GeometryCoordinates& queryGeometry,
         const float bearing,
         const double tileSize,
@@ -113,23 +113,50 @@ void FeatureIndex::query(
         if (indexedFeature.sortIndex == previousSortIndex) continue;
         previousSortIndex = indexedFeature.sortIndex;
 
-        addFeature(result, indexedFeature, queryGeometry, queryOptions, geometryTileData, tileID, style, bearing, pixelsToTileUnits);
+        if (!addFeature(callback, indexedFeature, queryGeometry, queryOptions, geometryTileData, tileID, style, bearing, pixelsToTileUnits)) {
+            return false;
+        }
     }
 
     // Query symbol features, if they've been placed.
     if (!collisionTile) {
-        return;
+        return true;
     }
 
     std::vector<IndexedSubfeature> symbolFeatures = collisionTile->queryRenderedSymbols(queryGeometry, scale);
     std::sort(symbolFeatures.begin(), symbolFeatures.end(), topDownSymbols);
     for (const auto& symbolFeature : symbolFeatures) {
-        addFeature(result, symbolFeature, queryGeometry, queryOptions, geometryTileData, tileID, style, bearing, pixelsToTileUnits);
+        if (!addFeature(callback, symbolFeature, queryGeometry, queryOptions, geometryTileData, tileID, style, bearing, pixelsToTileUnits)) {
+            return false;
+        }
     }
+
+    return true;
 }
 
-void FeatureIndex::addFeature(
-    std::unordered_map<std::string, std::vector<Feature>>& result,
+static Feature convertQueriedFeature(const GeometryTileFeature& geometryTileFeature,
+                                     const CanonicalTileID& tileID,
+                                     const RenderedQueryOptions& options) {
+    if (!options.properties && options.geometry) {
+        return convertFeature(geometryTileFeature, tileID);
+    }
+
+    Feature feature { options.geometry ? convertGeometry(geometryTileFeature, tileID) : Point<double>() };
+    if (options.properties) {
+        for (const auto& name : *options.properties) {
+            if (auto value = geometryTileFeature.getValue(name)) {
+                feature.properties.emplace(name, std::move(*value));
+            }
+        }
+    } else {
+        feature.properties = geometryTileFeature.getProperties();
+    }
+    feature.id = geometryTileFeature.getID();
+    return feature;
+}
+
+bool FeatureIndex::addFeature(
+    const RenderedFeatureCallback& callback,
     const IndexedSubfeature& indexedFeature,
     const GeometryCoordinates& queryGeometry,
     const RenderedQueryOptions& options,
@@ -141,7 +168,7 @@ void FeatureIndex::addFeature(
 
     auto& layerIDs = bucketLayerIDs.at(indexedFeature.bucketName);
     if (options.layerIDs && !vectorsIntersect(layerIDs, *options.layerIDs)) {
-        return;
+        return true;
     }
 
     auto sourceLayer = geometryTileData.getLayer(indexedFeature.sourceLayerName);
@@ -166,8 +193,12 @@ void FeatureIndex::addFeature(
             continue;
         }
 
-        result[layerID].push_back(convertFeature(*geometryTileFeature, tileID));
+        if (!callback(layerID, convertQueriedFeature(*geometryTileFeature, tileID, options))) {
+            return false;
+        }
     }
+
+    return true;
 }
 
 optional<GeometryCoordinates> FeatureIndex::translateQueryGeometry(
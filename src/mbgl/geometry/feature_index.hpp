@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/style/types.hpp>
+#include <mbgl/renderer/query.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
 #include <mbgl/util/grid_index.hpp>
 #include <mbgl/util/feature.hpp>
@@ -12,7 +13,6 @@
 namespace mbgl {
 
 class GeometryTile;
-class RenderedQueryOptions;
 class RenderStyle;
 
 class CollisionTile;
@@ -33,8 +33,9 @@ public:
 
     void insert(const GeometryCollection&, std::size_t index, const std::string& sourceLayerName, const std::string& bucketName);
 
-    void query(
-            std::unordered_map<std::string, std::vector<Feature>>& result,
+    // Passes every matching feature to the callback. Returns false if the callback stopped the query.
+    bool query(
+            const RenderedFeatureCallback&,
             const GeometryCoordinates& queryGeometry,
             const float bearing,
             const double tileSize,
@@ -56,8 +57,8 @@ public:
     void setBucketLayerIDs(const std::string& bucketName, const std::vector<std::string>& layerIDs);
 
 private:
-    void addFeature(
-            std::unordered_map<std::string, std::vector<Feature>>& result,
+    bool addFeature(
+            const RenderedFeatureCallback&,
             const IndexedSubfeature&,
             const GeometryCoordinates& queryGeometry,
             const RenderedQueryOptions& options,
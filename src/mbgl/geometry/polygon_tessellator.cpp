@@ -0,0 +1,148 @@
+#include <mbgl/geometry/polygon_tessellator.hpp>
+
+#include <mapbox/earcut.hpp>
+
+#include <cassert>
+
+namespace mapbox {
+namespace util {
+template <> struct nth<0, mbgl::GeometryCoordinate> {
+    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.x; };
+};
+
+template <> struct nth<1, mbgl::GeometryCoordinate> {
+    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.y; };
+};
+} // namespace util
+} // namespace mapbox
+
+namespace mbgl {
+
+namespace {
+
+// Number of distinct points in the ring, not counting a closing point.
+std::size_t ringLength(const GeometryCoordinates& ring) {
+    std::size_t length = ring.size();
+    if (length > 1 && ring.front() == ring.back()) {
+        length--;
+    }
+    return length;
+}
+
+// Counts how often the sign of an edge's x or y component changes around the ring.
+class DirectionChanges {
+public:
+    void add(int64_t delta) {
+        if (delta == 0) {
+            return;
+        }
+        const int sign = delta > 0 ? 1 : -1;
+        if (first == 0) {
+            first = sign;
+        } else if (sign != last) {
+            changes++;
+        }
+        last = sign;
+    }
+
+    std::size_t total() const {
+        return changes + (first != last ? 1 : 0);
+    }
+
+private:
+    int first = 0;
+    int last = 0;
+    std::size_t changes = 0;
+};
+
+} // namespace
+
+bool isConvex(const GeometryCoordinates& ring) {
+    const std::size_t length = ringLength(ring);
+    if (length < 3) {
+        return false;
+    }
+
+    int64_t turn = 0;
+    DirectionChanges xChanges;
+    DirectionChanges yChanges;
+
+    bool hasPrevious = false;
+    int64_t previousX = 0, previousY = 0;
+    int64_t firstX = 0, firstY = 0;
+
+    // Returns false if the edges turn against the direction of previous turns, or double back.
+    auto checkTurn = [&](int64_t ax, int64_t ay, int64_t bx, int64_t by) {
+        const int64_t cross = ax * by - ay * bx;
+        if (cross == 0) {
+            return ax * bx + ay * by > 0;
+        }
+        if (turn == 0) {
+            turn = cross;
+        }
+        return (cross > 0) == (turn > 0);
+    };
+
+    for (std::size_t i = 0; i < length; i++) {
+        const GeometryCoordinate& a = ring[i];
+        const GeometryCoordinate& b = ring[(i + 1) % length];
+        const int64_t dx = int64_t(b.x) - a.x;
+        const int64_t dy = int64_t(b.y) - a.y;
+        if (dx == 0 && dy == 0) {
+            continue;
+        }
+
+        if (!hasPrevious) {
+            firstX = dx;
+            firstY = dy;
+            hasPrevious = true;
+        } else if (!checkTurn(previousX, previousY, dx, dy)) {
+            return false;
+        }
+
+        xChanges.add(dx);
+        yChanges.add(dy);
+        previousX = dx;
+        previousY = dy;
+    }
+
+    if (!hasPrevious || !checkTurn(previousX, previousY, firstX, firstY)) {
+        return false;
+    }
+
+    // Edges that consistently turn the same way can still wind around the interior several times,
+    // as in a pentagram. A ring that winds once changes its direction twice along each axis.
+    return turn != 0 && xChanges.total() <= 2 && yChanges.total() <= 2;
+}
+
+PolygonTessellator::PolygonTessellator() = default;
+
+PolygonTessellator::~PolygonTessellator() = default;
+
+const std::vector<uint32_t>& PolygonTessellator::tessellate(const GeometryCollection& polygon) {
+    if (polygon.size() == 1 && isConvex(polygon.front())) {
+        const std::size_t length = ringLength(polygon.front());
+        indices.clear();
+        indices.reserve((length - 2) * 3);
+        for (uint32_t i = 1; i + 1 < length; i++) {
+            indices.push_back(0);
+            indices.push_back(i);
+            indices.push_back(i + 1);
+        }
+        return indices;
+    }
+
+    if (!earcut) {
+        earcut = std::make_unique<mapbox::detail::Earcut<uint32_t>>();
+    }
+    (*earcut)(polygon);
+    assert(earcut->indices.size() % 3 == 0);
+    return earcut->indices;
+}
+
+void PolygonTessellator::clear() {
+    indices = {};
+    earcut.reset();
+}
+
+} // namespace mbgl
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace mapbox {
+namespace detail {
+template <typename N>
+class Earcut;
+} // namespace detail
+} // namespace mapbox
+
+namespace mbgl {
+
+// Triangulates the polygons of fill buckets. Convex polygons without holes, which include most
+// building footprints, are triangulated as fans; everything else is handed to earcut. Buffers are
+// kept between calls, so a bucket should use one instance for all of its polygons.
+class PolygonTessellator : private util::noncopyable {
+public:
+    PolygonTessellator();
+    ~PolygonTessellator();
+
+    // Returns three indices per triangle into the concatenated rings of the polygon. The result is
+    // valid until the next call.
+    const std::vector<uint32_t>& tessellate(const GeometryCollection& polygon);
+
+    // Releases the buffers once no more polygons are going to be tessellated.
+    void clear();
+
+private:
+    std::vector<uint32_t> indices;
+    std::unique_ptr<mapbox::detail::Earcut<uint32_t>> earcut;
+};
+
+// Returns true if the ring is a convex polygon that winds around its interior exactly once. The
+// ring may repeat its first point at the end.
+bool isConvex(const GeometryCoordinates& ring);
+
+} // namespace mbgl
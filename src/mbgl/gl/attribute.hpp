@@ -32,6 +32,7 @@ class AttributeBinding {
 public:
     DataType attributeType;
     uint8_t attributeSize;
+    bool attributeNormalized;
     uint32_t attributeOffset;
 
     BufferID vertexBuffer;
@@ -40,8 +41,8 @@ public:
 
     friend bool operator==(const AttributeBinding& lhs,
                            const AttributeBinding& rhs) {
-        return std::tie(lhs.attributeType, lhs.attributeSize, lhs.attributeOffset, lhs.vertexBuffer, lhs.vertexSize, lhs.vertexOffset)
-            == std::tie(rhs.attributeType, rhs.attributeSize, rhs.attributeOffset, rhs.vertexBuffer, rhs.vertexSize, rhs.vertexOffset);
+        return std::tie(lhs.attributeType, lhs.attributeSize, lhs.attributeNormalized, lhs.attributeOffset, lhs.vertexBuffer, lhs.vertexSize, lhs.vertexOffset)
+            == std::tie(rhs.attributeType, rhs.attributeSize, rhs.attributeNormalized, rhs.attributeOffset, rhs.vertexBuffer, rhs.vertexSize, rhs.vertexOffset);
     }
 };
 
@@ -51,12 +52,15 @@ using AttributeBindingArray = std::array<optional<AttributeBinding>, MAX_ATTRIBU
     gl::Attribute<T,N> manages the binding of a vertex buffer to a GL program attribute.
       - T is the underlying primitive type (exposed as Attribute<T,N>::ValueType)
       - N is the number of components in the attribute declared in the shader (exposed as Attribute<T,N>::Dimensions)
+      - Normalized is whether integer values are mapped to 0..1 (or -1..1 if signed) before they reach
+        the shader, rather than converted to floats as they are
 */
-template <class T, std::size_t N>
+template <class T, std::size_t N, bool Normalized_ = false>
 class Attribute {
 public:
     using ValueType = T;
     static constexpr size_t Dimensions = N;
+    static constexpr bool Normalized = Normalized_;
     using Value = std::array<T, N>;
 
     using Location = AttributeLocation;
@@ -79,6 +83,7 @@ public:
         return AttributeBinding {
             DataTypeOf<T>::value,
             static_cast<uint8_t>(attributeSize),
+            Normalized,
             static_cast<uint32_t>(Vertex::attributeOffsets[attributeIndex]),
             buffer.buffer,
             static_cast<uint32_t>(sizeof(Vertex)),
@@ -216,12 +216,14 @@ UniqueBuffer Context::createVertexBuffer(const void* data, std::size_t size, con
     UniqueBuffer result { std::move(id), { this } };
     vertexBuffer = result;
     MBGL_CHECK_ERROR(glBufferData(GL_ARRAY_BUFFER, size, data, static_cast<GLenum>(usage)));
+    statistics.bufferBytes += size;
     return result;
 }
 
 void Context::updateVertexBuffer(UniqueBuffer& buffer, const void* data, std::size_t size) {
     vertexBuffer = buffer;
     MBGL_CHECK_ERROR(glBufferSubData(GL_ARRAY_BUFFER, 0, size, data));
+    statistics.bufferBytes += size;
 }
 
 UniqueBuffer Context::createIndexBuffer(const void* data, std::size_t size) {
@@ -231,6 +233,7 @@ UniqueBuffer Context::createIndexBuffer(const void* data, std::size_t size) {
     bindVertexArray = 0;
     globalVertexArrayState.indexBuffer = result;
     MBGL_CHECK_ERROR(glBufferData(GL_ELEMENT_ARRAY_BUFFER, size, data, GL_STATIC_DRAW));
+    statistics.bufferBytes += size;
     return result;
 }
 
@@ -486,6 +489,9 @@ void Context::updateTexture(
     MBGL_CHECK_ERROR(glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLenum>(format), size.width,
                                   size.height, 0, static_cast<GLenum>(format), GL_UNSIGNED_BYTE,
                                   data));
+    if (data) {
+        statistics.textureBytes += size.area() * (format == TextureFormat::RGBA ? 4 : 1);
+    }
 }
 
 void Context::bindTexture(Texture& obj,
@@ -556,6 +562,7 @@ void Context::setDirtyState() {
     clearDepth.setDirty();
     clearColor.setDirty();
     clearStencil.setDirty();
+    scissor.setDirty();
     program.setDirty();
     lineWidth.setDirty();
     activeTexture.setDirty();
@@ -654,6 +661,17 @@ void Context::setStencilMode(const StencilMode& stencil) {
             stencilFunc = { test.func, stencil.ref, test.mask };
         }, stencil.test);
     }
+
+    // Only reset the scissor test if we enabled it ourselves, so that a scissor test set up by the
+    // backend stays intact.
+    if (stencil.scissor) {
+        scissorTest = true;
+        scissor = *stencil.scissor;
+        stencilScissor = true;
+    } else if (stencilScissor) {
+        scissorTest = false;
+        stencilScissor = false;
+    }
 }
 
 void Context::setColorMode(const ColorMode& color) {
@@ -679,9 +697,15 @@ void Context::draw(PrimitiveType primitiveType,
         static_cast<GLsizei>(indexLength),
         GL_UNSIGNED_SHORT,
         reinterpret_cast<GLvoid*>(sizeof(uint16_t) * indexOffset)));
+    statistics.drawCalls++;
+    statistics.indices += indexLength;
 }
 
 void Context::performCleanup() {
+    statistics.deletedObjects += abandonedPrograms.size() + abandonedShaders.size() +
+        abandonedBuffers.size() + abandonedTextures.size() + abandonedVertexArrays.size() +
+        abandonedFramebuffers.size() + abandonedRenderbuffers.size();
+
     for (auto id : abandonedPrograms) {
         if (program == id) {
             program.setDirty();
@@ -36,6 +36,19 @@ class Debugging;
 class ProgramBinary;
 } // namespace extension
 
+// Running totals of the work submitted through a Context. The owner resets them as needed, e.g.
+// at the beginning of every frame.
+class Statistics {
+public:
+    std::size_t drawCalls = 0;
+    std::size_t programBinds = 0;
+    std::size_t vertices = 0;
+    std::size_t indices = 0;
+    std::size_t textureBytes = 0;
+    std::size_t bufferBytes = 0;
+    std::size_t deletedObjects = 0;
+};
+
 class Context : private util::noncopyable {
 public:
     Context();
@@ -238,10 +251,14 @@ private:
     State<value::ClearStencil> clearStencil;
     State<value::LineWidth> lineWidth;
     State<value::BindRenderbuffer> bindRenderbuffer;
+    State<value::Scissor> scissor;
 #if not MBGL_USE_GLES2
     State<value::PointSize> pointSize;
 #endif // MBGL_USE_GLES2
 
+    // Whether the scissor test was enabled by a StencilMode, as opposed to by the backend.
+    bool stencilScissor = false;
+
     UniqueBuffer createVertexBuffer(const void* data, std::size_t size, const BufferUsage usage);
     void updateVertexBuffer(UniqueBuffer& buffer, const void* data, std::size_t size);
     UniqueBuffer createIndexBuffer(const void* data, std::size_t size);
@@ -275,6 +292,8 @@ private:
     std::vector<RenderbufferID> abandonedRenderbuffers;
 
 public:
+    Statistics statistics;
+
     // For testing
     bool disableVAOExtension = false;
 };
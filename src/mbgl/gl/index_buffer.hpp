@@ -5,6 +5,7 @@
 #include <mbgl/util/ignore.hpp>
 
 #include <vector>
+#include <utility>
 
 namespace mbgl {
 namespace gl {
@@ -25,6 +26,7 @@ public:
 
     bool empty() const { return v.empty(); }
     void clear() { v.clear(); }
+    void assign(std::vector<uint16_t> vector) { v = std::move(vector); }
     const uint16_t* data() const { return v.data(); }
     const std::vector<uint16_t>& vector() const { return v; }
 
@@ -118,7 +118,8 @@ public:
               const AttributeBindings& attributeBindings,
               const IndexBuffer<DrawMode>& indexBuffer,
               std::size_t indexOffset,
-              std::size_t indexLength) {
+              std::size_t indexLength,
+              std::size_t vertexLength) {
         static_assert(std::is_same<Primitive, typename DrawMode::Primitive>::value, "incompatible draw mode");
 
         context.setDrawMode(drawMode);
@@ -126,7 +127,10 @@ public:
         context.setStencilMode(stencilMode);
         context.setColorMode(colorMode);
 
-        context.program = program;
+        if (context.program != program) {
+            context.statistics.programBinds++;
+            context.program = program;
+        }
 
         Uniforms::bind(uniformsState, uniformValues);
 
@@ -137,6 +141,7 @@ public:
         context.draw(drawMode.primitiveType,
                      indexOffset,
                      indexLength);
+        context.statistics.vertices += vertexLength;
     }
 
 private:
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <mbgl/util/variant.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/size.hpp>
 
 namespace mbgl {
 namespace gl {
@@ -57,8 +59,18 @@ public:
     Op depthFail;
     Op pass;
 
+    // A framebuffer rectangle that drawing is restricted to with the scissor test. Tiles that
+    // don't overlap each other can be clipped this way without a stencil mask.
+    struct Scissor {
+        int32_t x;
+        int32_t y;
+        Size size;
+    };
+
+    optional<Scissor> scissor;
+
     static StencilMode disabled() {
-       return StencilMode { Always(), 0, 0, Keep, Keep, Keep };
+       return StencilMode { Always(), 0, 0, Keep, Keep, Keep, {} };
     }
 };
 
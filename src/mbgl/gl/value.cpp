@@ -279,6 +279,19 @@ ScissorTest::Type ScissorTest::Get() {
     return scissorTest;
 }
 
+const constexpr Scissor::Type Scissor::Default;
+
+void Scissor::Set(const Type& value) {
+    MBGL_CHECK_ERROR(glScissor(value.x, value.y, value.size.width, value.size.height));
+}
+
+Scissor::Type Scissor::Get() {
+    GLint scissor[4];
+    MBGL_CHECK_ERROR(glGetIntegerv(GL_SCISSOR_BOX, scissor));
+    return { static_cast<int32_t>(scissor[0]), static_cast<int32_t>(scissor[1]),
+             { static_cast<uint32_t>(scissor[2]), static_cast<uint32_t>(scissor[3]) } };
+}
+
 const constexpr BindFramebuffer::Type BindFramebuffer::Default;
 
 void BindFramebuffer::Set(const Type& value) {
@@ -375,7 +388,7 @@ void VertexAttribute::Set(const optional<AttributeBinding>& binding, Context& co
             location,
             static_cast<GLint>(binding->attributeSize),
             static_cast<GLenum>(binding->attributeType),
-            static_cast<GLboolean>(false),
+            static_cast<GLboolean>(binding->attributeNormalized),
             static_cast<GLsizei>(binding->vertexSize),
             reinterpret_cast<GLvoid*>(binding->attributeOffset + (binding->vertexSize * binding->vertexOffset))));
     } else {
@@ -190,6 +190,13 @@ struct ScissorTest {
     static Type Get();
 };
 
+struct Scissor {
+    using Type = StencilMode::Scissor;
+    static const constexpr Type Default = { 0, 0, { 0, 0 } };
+    static void Set(const Type&);
+    static Type Get();
+};
+
 constexpr bool operator!=(const Viewport::Type& a, const Viewport::Type& b) {
     return a.x != b.x || a.y != b.y || a.size != b.size;
 }
@@ -198,6 +205,14 @@ constexpr bool operator==(const Viewport::Type& a, const Viewport::Type& b) {
     return !(a != b);
 }
 
+constexpr bool operator!=(const Scissor::Type& a, const Scissor::Type& b) {
+    return a.x != b.x || a.y != b.y || a.size != b.size;
+}
+
+constexpr bool operator==(const Scissor::Type& a, const Scissor::Type& b) {
+    return !(a != b);
+}
+
 struct BindFramebuffer {
     using Type = FramebufferID;
     static const constexpr Type Default = 0;
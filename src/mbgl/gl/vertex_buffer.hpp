@@ -6,6 +6,7 @@
 #include <mbgl/util/ignore.hpp>
 
 #include <vector>
+#include <utility>
 
 namespace mbgl {
 namespace gl {
@@ -27,6 +28,7 @@ public:
 
     bool empty() const { return v.empty(); }
     void clear() { v.clear(); }
+    void assign(std::vector<Vertex> vector) { v = std::move(vector); }
     const Vertex* data() const { return v.data(); }
     const std::vector<Vertex>& vector() const { return v; }
 
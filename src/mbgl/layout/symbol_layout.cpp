@@ -10,6 +10,7 @@
 #include <mbgl/text/get_anchors.hpp>
 #include <mbgl/text/collision_tile.hpp>
 #include <mbgl/text/shaping.hpp>
+#include <mbgl/text/shaping_cache.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/utf.hpp>
 #include <mbgl/util/token.hpp>
@@ -179,7 +180,10 @@ bool SymbolLayout::hasSymbolInstances() const {
 }
 
 void SymbolLayout::prepare(const GlyphMap& glyphMap, const GlyphPositions& glyphPositions,
-                           const ImageMap& imageMap, const ImagePositions& imagePositions) {
+                           const ImageMap& imageMap, const ImagePositions& imagePositions,
+                           ShapingCache& shapingCache,
+                           BiDi& bidi,
+                           ShapingBuffers& shapingBuffers) {
     const bool textAlongLine = layout.get<TextRotationAlignment>() == AlignmentType::Map &&
         layout.get<SymbolPlacement>() == SymbolPlacementType::Line;
 
@@ -202,8 +206,9 @@ void SymbolLayout::prepare(const GlyphMap& glyphMap, const GlyphPositions& glyph
         if (feature.text) {
             auto applyShaping = [&] (const std::u16string& text, WritingModeType writingMode) {
                 const float oneEm = 24.0f;
-                const Shaping result = getShaping(
+                const Shaping result = shapingCache.get(
                     /* string */ text,
+                    /* font stack */ layout.get<TextFont>(),
                     /* maxWidth: ems */ layout.get<SymbolPlacement>() != SymbolPlacementType::Line ?
                         layout.get<TextMaxWidth>() * oneEm : 0,
                     /* lineHeight: ems */ layout.get<TextLineHeight>() * oneEm,
@@ -214,6 +219,7 @@ void SymbolLayout::prepare(const GlyphMap& glyphMap, const GlyphPositions& glyph
                     /* verticalHeight */ oneEm,
                     /* writingMode */ writingMode,
                     /* bidirectional algorithm object */ bidi,
+                    /* reusable line breaking scratch space */ shapingBuffers,
                     /* glyphs */ glyphs);
 
                 return result;
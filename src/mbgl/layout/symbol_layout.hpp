@@ -4,7 +4,6 @@
 #include <mbgl/style/layers/symbol_layer_properties.hpp>
 #include <mbgl/layout/symbol_feature.hpp>
 #include <mbgl/layout/symbol_instance.hpp>
-#include <mbgl/text/bidi.hpp>
 #include <mbgl/style/layers/symbol_layer_impl.hpp>
 #include <mbgl/programs/symbol_program.hpp>
 
@@ -21,6 +20,9 @@ class SymbolBucket;
 class Anchor;
 class RenderLayer;
 class PlacedSymbol;
+class ShapingCache;
+class ShapingBuffers;
+class BiDi;
 
 namespace style {
 class Filter;
@@ -35,7 +37,10 @@ public:
                  GlyphDependencies&);
 
     void prepare(const GlyphMap&, const GlyphPositions&,
-                 const ImageMap&, const ImagePositions&);
+                 const ImageMap&, const ImagePositions&,
+                 ShapingCache&,
+                 BiDi&,
+                 ShapingBuffers&);
 
     std::unique_ptr<SymbolBucket> place(CollisionTile&);
 
@@ -89,8 +94,6 @@ private:
 
     std::vector<SymbolInstance> symbolInstances;
     std::vector<SymbolFeature> features;
-
-    BiDi bidi; // Consider moving this up to geometry tile worker to reduce reinstantiation costs; use of BiDi/ubiditransform object must be constrained to one thread
 };
 
 } // namespace mbgl
@@ -695,6 +695,8 @@ void Map::Impl::onUpdate(Update flags) {
         annotationManager.updateData();
     }
 
+    style->impl->parseDeferredLayers(transform.getZoom());
+
     UpdateParameters params = {
         style->impl->isLoaded(),
         mode,
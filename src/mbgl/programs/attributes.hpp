@@ -50,39 +50,42 @@ struct a_offset {
 
 // Paint attributes
 
+// Colors are packed into two 16-bit integers with packUint8Pair(), which reach the shader as
+// the same float values it unpacks. Opacities are stored as 16-bit normalized integers.
+
 struct a_color {
     static auto name() { return "a_color"; }
-    using Type = gl::Attribute<float, 2>;
+    using Type = gl::Attribute<uint16_t, 2>;
 };
 
 struct a_fill_color {
     static auto name() { return "a_fill_color"; }
-    using Type = gl::Attribute<float, 2>;
+    using Type = gl::Attribute<uint16_t, 2>;
 };
 
 struct a_halo_color {
     static auto name() { return "a_halo_color"; }
-    using Type = gl::Attribute<float, 2>;
+    using Type = gl::Attribute<uint16_t, 2>;
 };
 
 struct a_stroke_color {
     static auto name() { return "a_stroke_color"; }
-    using Type = gl::Attribute<float, 2>;
+    using Type = gl::Attribute<uint16_t, 2>;
 };
 
 struct a_outline_color {
     static auto name() { return "a_outline_color"; }
-    using Type = gl::Attribute<float, 2>;
+    using Type = gl::Attribute<uint16_t, 2>;
 };
 
 struct a_opacity {
     static auto name() { return "a_opacity"; }
-    using Type = gl::Attribute<float, 1>;
+    using Type = gl::Attribute<uint16_t, 1, true>;
 };
 
 struct a_stroke_opacity {
     static auto name() { return "a_stroke_opacity"; }
-    using Type = gl::Attribute<float, 1>;
+    using Type = gl::Attribute<uint16_t, 1, true>;
 };
 
 struct a_blur {
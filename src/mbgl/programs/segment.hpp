@@ -5,10 +5,17 @@
 
 #include <cstddef>
 #include <vector>
-#include <map>
+#include <utility>
 
 namespace mbgl {
 
+// Draw calls select their vertex array within a segment by index. Style layers use their render
+// index (see RenderLayer::getRenderIndex()), which starts at `firstLayerVertexArrayIndex`; draws
+// that don't belong to a layer use the reserved indices below it.
+constexpr std::size_t clippingVertexArrayIndex = 0;
+constexpr std::size_t debugVertexArrayIndex = 1;
+constexpr std::size_t firstLayerVertexArrayIndex = 2;
+
 template <class Attributes>
 class Segment {
 public:
@@ -27,14 +34,26 @@ public:
     std::size_t vertexLength;
     std::size_t indexLength;
 
-    // One VertexArray per layer ID. This minimizes rebinding in cases where
+    gl::VertexArray& vertexArray(gl::Context& context, std::size_t index) const {
+        for (auto& entry : vertexArrays) {
+            if (entry.first == index) {
+                return entry.second;
+            }
+        }
+        vertexArrays.emplace_back(index, context.createVertexArray());
+        return vertexArrays.back().second;
+    }
+
+private:
+    // One VertexArray per layer index. This minimizes rebinding in cases where
     // several layers share buckets but have different sets of active attributes.
     // This can happen:
     //   * when two layers have the same layout properties, but differing
     //     data-driven paint properties
     //   * when two fill layers have the same layout properties, but one
     //     uses fill-color and the other uses fill-pattern
-    mutable std::map<std::string, gl::VertexArray> vertexArrays;
+    // Only a handful of layers share a bucket, so a linear scan is cheaper than a map lookup.
+    mutable std::vector<std::pair<std::size_t, gl::VertexArray>> vertexArrays;
 };
 
 template <class Attributes>
@@ -2,8 +2,10 @@
 
 #include <mbgl/util/noncopyable.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <atomic>
+#include <string>
 
 namespace mbgl {
 
@@ -30,6 +32,19 @@ public:
 
     virtual bool hasData() const = 0;
 
+    // Buckets that can be stored in the layout cache return their geometry in serialized form.
+    // This must be called before the bucket is uploaded.
+    virtual optional<std::string> serialize() const {
+        return {};
+    }
+
+    // Restores geometry previously returned by serialize() into an empty bucket, in place of
+    // adding the features. Returns false if this bucket doesn't support the layout cache, and
+    // throws if the data is malformed.
+    virtual bool deserialize(const std::string&) {
+        return false;
+    }
+
     virtual float getQueryRadius(const RenderLayer&) const {
         return 0;
     };
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <mbgl/programs/segment.hpp>
+#include <mbgl/util/ignore.hpp>
+#include <mbgl/util/string.hpp>
+#include <mbgl/util/type_list.hpp>
+
+#include <protozero/pbf_reader.hpp>
+#include <protozero/pbf_writer.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace mbgl {
+
+// Helpers for serializing bucket geometry into the layout cache. Vertex and index arrays are stored
+// as raw bytes, so entries are only readable by builds with the same vertex layouts and byte order.
+
+namespace detail {
+
+template <class>
+struct AttributesSignature;
+
+template <class... As>
+struct AttributesSignature<TypeList<As...>> {
+    static std::string get() {
+        std::string result;
+        util::ignore({ (result += std::string(As::name()) + ":" +
+                                  util::toString(sizeof(typename As::Type::Value)) + ",", 0)... });
+        return result;
+    }
+};
+
+} // namespace detail
+
+// Describes the vertex layout of serialized buckets with the given layout attributes. It is part of
+// the cache key, so that entries written by builds with different vertex formats aren't loaded.
+template <class LayoutAttributes>
+std::string bucketFormatSignature() {
+    return detail::AttributesSignature<typename LayoutAttributes::Types>::get() +
+           util::toString(sizeof(typename LayoutAttributes::Vertex));
+}
+
+template <class T>
+void writeBucketArray(protozero::pbf_writer& pbf, protozero::pbf_tag_type tag, const std::vector<T>& array) {
+    static_assert(std::is_standard_layout<T>::value, "array elements must use standard layout");
+    pbf.add_bytes(tag, reinterpret_cast<const char*>(array.data()), array.size() * sizeof(T));
+}
+
+template <class T>
+std::vector<T> readBucketArray(protozero::pbf_reader& pbf) {
+    const protozero::data_view view = pbf.get_view();
+    if (view.size() % sizeof(T) != 0) {
+        throw std::runtime_error("Cached bucket array has an invalid size");
+    }
+    std::vector<T> array(view.size() / sizeof(T));
+    std::memcpy(array.data(), view.data(), view.size());
+    return array;
+}
+
+template <class Attributes>
+void writeBucketSegments(protozero::pbf_writer& pbf, protozero::pbf_tag_type tag, const SegmentVector<Attributes>& segments) {
+    std::vector<uint64_t> values;
+    values.reserve(segments.size() * 4);
+    for (const auto& segment : segments) {
+        values.push_back(segment.vertexOffset);
+        values.push_back(segment.indexOffset);
+        values.push_back(segment.vertexLength);
+        values.push_back(segment.indexLength);
+    }
+    pbf.add_packed_uint64(tag, values.begin(), values.end());
+}
+
+// Checks that the segments lie within the vertex and index arrays they refer to, and that every
+// index of a segment refers to one of the segment's vertices, since indices are passed to the GPU
+// unchecked.
+template <class Attributes>
+SegmentVector<Attributes> readBucketSegments(protozero::pbf_reader& pbf,
+                                             std::size_t vertexCount,
+                                             const std::vector<uint16_t>& indices) {
+    std::vector<uint64_t> values;
+    for (const uint64_t value : pbf.get_packed_uint64()) {
+        values.push_back(value);
+    }
+    if (values.size() % 4 != 0) {
+        throw std::runtime_error("Cached bucket segments have an invalid size");
+    }
+
+    SegmentVector<Attributes> segments;
+    for (std::size_t i = 0; i < values.size(); i += 4) {
+        const uint64_t vertexOffset = values[i];
+        const uint64_t indexOffset = values[i + 1];
+        const uint64_t vertexLength = values[i + 2];
+        const uint64_t indexLength = values[i + 3];
+        if (vertexOffset > vertexCount || vertexLength > vertexCount - vertexOffset ||
+            indexOffset > indices.size() || indexLength > indices.size() - indexOffset) {
+            throw std::runtime_error("Cached bucket segment is out of range");
+        }
+        for (uint64_t j = indexOffset; j < indexOffset + indexLength; j++) {
+            if (indices[j] >= vertexLength) {
+                throw std::runtime_error("Cached bucket index is out of range");
+            }
+        }
+        segments.emplace_back(vertexOffset, indexOffset, vertexLength, indexLength);
+    }
+    return segments;
+}
+
+} // namespace mbgl
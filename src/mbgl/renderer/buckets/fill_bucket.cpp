@@ -1,26 +1,13 @@
 #include <mbgl/renderer/buckets/fill_bucket.hpp>
 #include <mbgl/programs/fill_program.hpp>
 #include <mbgl/renderer/bucket_parameters.hpp>
+#include <mbgl/renderer/buckets/bucket_serialization.hpp>
 #include <mbgl/style/layers/fill_layer_impl.hpp>
 #include <mbgl/renderer/layers/render_fill_layer.hpp>
 #include <mbgl/util/math.hpp>
 
-#include <mapbox/earcut.hpp>
-
 #include <cassert>
 
-namespace mapbox {
-namespace util {
-template <> struct nth<0, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.x; };
-};
-
-template <> struct nth<1, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) { return t.y; };
-};
-} // namespace util
-} // namespace mapbox
-
 namespace mbgl {
 
 using namespace style;
@@ -35,6 +22,7 @@ FillBucket::FillBucket(const BucketParameters& parameters, const std::vector<con
             std::forward_as_tuple(
                 layer->as<RenderFillLayer>()->evaluated,
                 parameters.tileID.overscaledZ));
+        cacheable = cacheable && FillProgram::PaintPropertyBinders::constants(layer->as<RenderFillLayer>()->evaluated).all();
     }
 }
 
@@ -80,7 +68,7 @@ void FillBucket::addFeature(const GeometryTileFeature& feature,
             lineSegment.indexLength += nVertices * 2;
         }
 
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+        const std::vector<uint32_t>& indices = tessellator.tessellate(polygon);
 
         std::size_t nIndicies = indices.size();
         assert(nIndicies % 3 == 0);
@@ -108,6 +96,80 @@ void FillBucket::addFeature(const GeometryTileFeature& feature,
     }
 }
 
+std::string FillBucket::serializationFormat() {
+    // Bump the version when changing the fields written by serialize().
+    return "fill/1/" + bucketFormatSignature<FillLayoutAttributes>();
+}
+
+optional<std::string> FillBucket::serialize() const {
+    assert(!uploaded);
+    if (!cacheable) {
+        return {};
+    }
+
+    std::string data;
+    protozero::pbf_writer pbf(data);
+    writeBucketArray(pbf, 1 /* vertices */, vertices.vector());
+    writeBucketArray(pbf, 2 /* lines */, lines.vector());
+    writeBucketArray(pbf, 3 /* triangles */, triangles.vector());
+    writeBucketSegments(pbf, 4 /* line segments */, lineSegments);
+    writeBucketSegments(pbf, 5 /* triangle segments */, triangleSegments);
+    return data;
+}
+
+bool FillBucket::deserialize(const std::string& data) {
+    assert(!hasData());
+    if (!cacheable) {
+        return false;
+    }
+
+    // Segments are validated against the arrays, which are therefore read first.
+    std::vector<FillLayoutVertex> vertices_;
+    std::vector<uint16_t> lines_;
+    std::vector<uint16_t> triangles_;
+    protozero::pbf_reader pbf(data);
+    while (pbf.next()) {
+        switch (pbf.tag()) {
+        case 1: // vertices
+            vertices_ = readBucketArray<FillLayoutVertex>(pbf);
+            break;
+        case 2: // lines
+            lines_ = readBucketArray<uint16_t>(pbf);
+            break;
+        case 3: // triangles
+            triangles_ = readBucketArray<uint16_t>(pbf);
+            break;
+        default:
+            pbf.skip();
+            break;
+        }
+    }
+
+    SegmentVector<FillAttributes> lineSegments_;
+    SegmentVector<FillAttributes> triangleSegments_;
+    pbf = protozero::pbf_reader(data);
+    while (pbf.next()) {
+        switch (pbf.tag()) {
+        case 4: // line segments
+            lineSegments_ = readBucketSegments<FillAttributes>(pbf, vertices_.size(), lines_);
+            break;
+        case 5: // triangle segments
+            triangleSegments_ = readBucketSegments<FillAttributes>(pbf, vertices_.size(), triangles_);
+            break;
+        default:
+            pbf.skip();
+            break;
+        }
+    }
+
+    vertices.assign(std::move(vertices_));
+    lines.assign(std::move(lines_));
+    triangles.assign(std::move(triangles_));
+    lineSegments = std::move(lineSegments_);
+    triangleSegments = std::move(triangleSegments_);
+    return true;
+}
+
 void FillBucket::upload(gl::Context& context) {
     vertexBuffer = context.createVertexBuffer(std::move(vertices));
     lineIndexBuffer = context.createIndexBuffer(std::move(lines));
@@ -117,6 +179,8 @@ void FillBucket::upload(gl::Context& context) {
         pair.second.upload(context);
     }
 
+    tessellator.clear();
+
     uploaded = true;
 }
 
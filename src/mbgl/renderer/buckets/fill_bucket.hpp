@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/renderer/bucket.hpp>
+#include <mbgl/geometry/polygon_tessellator.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
 #include <mbgl/gl/index_buffer.hpp>
@@ -22,6 +23,12 @@ public:
                     const GeometryCollection&) override;
     bool hasData() const override;
 
+    optional<std::string> serialize() const override;
+    bool deserialize(const std::string&) override;
+
+    // Identifies the format written by serialize().
+    static std::string serializationFormat();
+
     void upload(gl::Context&) override;
 
     float getQueryRadius(const RenderLayer&) const override;
@@ -37,6 +44,13 @@ public:
     optional<gl::IndexBuffer<gl::Triangles>> triangleIndexBuffer;
 
     std::map<std::string, FillProgram::PaintPropertyBinders> paintPropertyBinders;
+
+private:
+    // Data-driven paint properties add per-feature attributes, which aren't cached.
+    bool cacheable = true;
+
+    // Released when the bucket is uploaded.
+    PolygonTessellator tessellator;
 };
 
 } // namespace mbgl
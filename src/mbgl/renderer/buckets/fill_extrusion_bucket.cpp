@@ -6,28 +6,8 @@
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/constants.hpp>
 
-#include <mapbox/earcut.hpp>
-
 #include <cassert>
 
-namespace mapbox {
-namespace util {
-template <>
-struct nth<0, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) {
-        return t.x;
-    };
-};
-
-template <>
-struct nth<1, mbgl::GeometryCoordinate> {
-    static int64_t get(const mbgl::GeometryCoordinate& t) {
-        return t.y;
-    };
-};
-} // namespace util
-} // namespace mapbox
-
 namespace mbgl {
 
 using namespace style;
@@ -123,7 +103,7 @@ void FillExtrusionBucket::addFeature(const GeometryTileFeature& feature,
             }
         }
 
-        std::vector<uint32_t> indices = mapbox::earcut(polygon);
+        const std::vector<uint32_t>& indices = tessellator.tessellate(polygon);
 
         std::size_t nIndices = indices.size();
         assert(nIndices % 3 == 0);
@@ -150,6 +130,8 @@ void FillExtrusionBucket::upload(gl::Context& context) {
         pair.second.upload(context);
     }
 
+    tessellator.clear();
+
     uploaded = true;
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <mbgl/renderer/bucket.hpp>
+#include <mbgl/geometry/polygon_tessellator.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
 #include <mbgl/gl/vertex_buffer.hpp>
 #include <mbgl/gl/index_buffer.hpp>
@@ -32,6 +33,10 @@ public:
     optional<gl::IndexBuffer<gl::Triangles>> indexBuffer;
     
     std::unordered_map<std::string, FillExtrusionProgram::PaintPropertyBinders> paintPropertyBinders;
+
+private:
+    // Released when the bucket is uploaded.
+    PolygonTessellator tessellator;
 };
 
 } // namespace mbgl
@@ -1,6 +1,7 @@
 #include <mbgl/renderer/buckets/line_bucket.hpp>
 #include <mbgl/renderer/layers/render_line_layer.hpp>
 #include <mbgl/renderer/bucket_parameters.hpp>
+#include <mbgl/renderer/buckets/bucket_serialization.hpp>
 #include <mbgl/style/layers/line_layer_impl.hpp>
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/constants.hpp>
@@ -24,6 +25,7 @@ LineBucket::LineBucket(const BucketParameters& parameters,
             std::forward_as_tuple(
                 layer->as<RenderLineLayer>()->evaluated,
                 parameters.tileID.overscaledZ));
+        cacheable = cacheable && LineProgram::PaintPropertyBinders::constants(layer->as<RenderLineLayer>()->evaluated).all();
     }
 }
 
@@ -450,6 +452,68 @@ void LineBucket::addPieSliceVertex(const GeometryCoordinate& currentVertex,
     }
 }
 
+std::string LineBucket::serializationFormat() {
+    // Bump the version when changing the fields written by serialize().
+    return "line/1/" + bucketFormatSignature<LineLayoutAttributes>();
+}
+
+optional<std::string> LineBucket::serialize() const {
+    assert(!uploaded);
+    if (!cacheable) {
+        return {};
+    }
+
+    std::string data;
+    protozero::pbf_writer pbf(data);
+    writeBucketArray(pbf, 1 /* vertices */, vertices.vector());
+    writeBucketArray(pbf, 2 /* triangles */, triangles.vector());
+    writeBucketSegments(pbf, 3 /* segments */, segments);
+    return data;
+}
+
+bool LineBucket::deserialize(const std::string& data) {
+    assert(!hasData());
+    if (!cacheable) {
+        return false;
+    }
+
+    // Segments are validated against the arrays, which are therefore read first.
+    std::vector<LineLayoutVertex> vertices_;
+    std::vector<uint16_t> triangles_;
+    protozero::pbf_reader pbf(data);
+    while (pbf.next()) {
+        switch (pbf.tag()) {
+        case 1: // vertices
+            vertices_ = readBucketArray<LineLayoutVertex>(pbf);
+            break;
+        case 2: // triangles
+            triangles_ = readBucketArray<uint16_t>(pbf);
+            break;
+        default:
+            pbf.skip();
+            break;
+        }
+    }
+
+    SegmentVector<LineAttributes> segments_;
+    pbf = protozero::pbf_reader(data);
+    while (pbf.next()) {
+        switch (pbf.tag()) {
+        case 3: // segments
+            segments_ = readBucketSegments<LineAttributes>(pbf, vertices_.size(), triangles_);
+            break;
+        default:
+            pbf.skip();
+            break;
+        }
+    }
+
+    vertices.assign(std::move(vertices_));
+    triangles.assign(std::move(triangles_));
+    segments = std::move(segments_);
+    return true;
+}
+
 void LineBucket::upload(gl::Context& context) {
     vertexBuffer = context.createVertexBuffer(std::move(vertices));
     indexBuffer = context.createIndexBuffer(std::move(triangles));
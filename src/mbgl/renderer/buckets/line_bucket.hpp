@@ -25,6 +25,12 @@ public:
                     const GeometryCollection&) override;
     bool hasData() const override;
 
+    optional<std::string> serialize() const override;
+    bool deserialize(const std::string&) override;
+
+    // Identifies the format written by serialize().
+    static std::string serializationFormat();
+
     void upload(gl::Context&) override;
 
     float getQueryRadius(const RenderLayer&) const override;
@@ -61,6 +67,9 @@ private:
     const uint32_t overscaling;
     const float zoom;
 
+    // Data-driven paint properties add per-feature attributes, which aren't cached.
+    bool cacheable = true;
+
     float getLineWidth(const RenderLineLayer& layer) const;
 };
 
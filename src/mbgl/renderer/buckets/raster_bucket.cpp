@@ -2,17 +2,20 @@
 #include <mbgl/renderer/layers/render_raster_layer.hpp>
 #include <mbgl/programs/raster_program.hpp>
 #include <mbgl/gl/context.hpp>
+#include <mbgl/util/image_buffer_pool.hpp>
 
 namespace mbgl {
 
 using namespace style;
 
-RasterBucket::RasterBucket(PremultipliedImage&& image_) {
-    image = std::make_shared<PremultipliedImage>(std::move(image_));
+RasterBucket::RasterBucket(PremultipliedImage&& image_)
+    : image(std::make_shared<PremultipliedImage>(std::move(image_))),
+      retainImage(false) {
 }
 
-RasterBucket::RasterBucket(std::shared_ptr<PremultipliedImage> image_): image(image_) {
-
+RasterBucket::RasterBucket(std::shared_ptr<PremultipliedImage> image_)
+    : image(std::move(image_)),
+      retainImage(true) {
 }
 
 void RasterBucket::upload(gl::Context& context) {
@@ -22,6 +25,14 @@ void RasterBucket::upload(gl::Context& context) {
     if (!texture) {
         texture = context.createTexture(*image);
     }
+    if (!retainImage) {
+        // The pixels now live in the texture; keeping a CPU copy only costs memory. Hand the
+        // buffer back so that the next decoded tile can reuse it.
+        if (image.use_count() == 1) {
+            ImageBufferPool::shared().recycle(std::move(*image));
+        }
+        image.reset();
+    }
     if (!segments.empty()) {
         vertexBuffer = context.createVertexBuffer(std::move(vertices));
         indexBuffer = context.createIndexBuffer(std::move(indices));
@@ -104,7 +115,7 @@ void RasterBucket::setMask(TileMask&& mask_) {
 }
 
 bool RasterBucket::hasData() const {
-    return !!image;
+    return image || texture;
 }
 
 } // namespace mbgl
@@ -26,6 +26,10 @@ public:
 
     std::shared_ptr<PremultipliedImage> image;
     optional<gl::Texture> texture;
+
+    // Buckets created from a decoded raster tile own their image and release it once it
+    // has been uploaded. Image source buckets share the image with the source and keep it.
+    bool retainImage;
     TileMask mask{ { 0, 0, 0 } };
 
     // Bucket specific vertices are used for Image Sources only
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include <vector>
 #include <memory>
 
@@ -7,6 +8,9 @@ namespace mbgl {
 
 class RenderLayer;
 
+// Returns a key that is equal for layers whose buckets can be shared.
+std::string layoutKey(const RenderLayer&);
+
 std::vector<std::vector<const RenderLayer*>> groupByLayout(const std::vector<std::unique_ptr<RenderLayer>>&);
 
 } // namespace mbgl
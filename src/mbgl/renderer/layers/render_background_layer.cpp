@@ -42,14 +42,19 @@ bool RenderBackgroundLayer::hasTransition() const {
     return unevaluated.hasTransition();
 }
 
-void RenderBackgroundLayer::render(PaintParameters& parameters, RenderSource*) {
-    // Note that for bottommost layers without a pattern, the background color is drawn with
-    // glClear rather than this method.
-
+style::FillPaintProperties::PossiblyEvaluated RenderBackgroundLayer::fillProperties() const {
     style::FillPaintProperties::PossiblyEvaluated properties;
     properties.get<FillPattern>() = evaluated.get<BackgroundPattern>();
     properties.get<FillOpacity>() = { evaluated.get<BackgroundOpacity>() };
     properties.get<FillColor>() = { evaluated.get<BackgroundColor>() };
+    return properties;
+}
+
+void RenderBackgroundLayer::render(PaintParameters& parameters, RenderSource*) {
+    // Note that for bottommost layers without a pattern, the background color is drawn with
+    // glClear rather than this method.
+
+    const style::FillPaintProperties::PossiblyEvaluated properties = fillProperties();
 
     const FillProgram::PaintPropertyBinders paintAttibuteData(properties, 0);
 
@@ -85,7 +90,7 @@ void RenderBackgroundLayer::render(PaintParameters& parameters, RenderSource*) {
                 paintAttibuteData,
                 properties,
                 parameters.state.getZoom(),
-                getID()
+                getRenderIndex()
             );
         }
     } else {
@@ -106,10 +111,20 @@ void RenderBackgroundLayer::render(PaintParameters& parameters, RenderSource*) {
                 paintAttibuteData,
                 properties,
                 parameters.state.getZoom(),
-                getID()
+                getRenderIndex()
             );
         }
     }
 }
 
+void RenderBackgroundLayer::preparePrograms(Programs& programs) {
+    const style::FillPaintProperties::PossiblyEvaluated properties = fillProperties();
+
+    if (!evaluated.get<BackgroundPattern>().to.empty()) {
+        programs.fillPattern.get(properties);
+    } else {
+        programs.fill.get(properties);
+    }
+}
+
 } // namespace mbgl
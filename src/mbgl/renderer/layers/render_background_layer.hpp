@@ -3,6 +3,7 @@
 #include <mbgl/renderer/render_layer.hpp>
 #include <mbgl/style/layers/background_layer_impl.hpp>
 #include <mbgl/style/layers/background_layer_properties.hpp>
+#include <mbgl/style/layers/fill_layer_properties.hpp>
 
 namespace mbgl {
 
@@ -15,6 +16,7 @@ public:
     void evaluate(const PropertyEvaluationParameters&) override;
     bool hasTransition() const override;
     void render(PaintParameters&, RenderSource*) override;
+    void preparePrograms(Programs&) override;
 
     std::unique_ptr<Bucket> createBucket(const BucketParameters&, const std::vector<const RenderLayer*>&) const override;
 
@@ -23,6 +25,10 @@ public:
     style::BackgroundPaintProperties::PossiblyEvaluated evaluated;
 
     const style::BackgroundLayer::Impl& impl() const;
+
+private:
+    // Background layers are drawn with the fill programs.
+    style::FillPaintProperties::PossiblyEvaluated fillProperties() const;
 };
 
 template <>
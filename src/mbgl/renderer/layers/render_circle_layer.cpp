@@ -64,7 +64,7 @@ void RenderCircleLayer::render(PaintParameters& parameters, RenderSource*) {
             gl::Triangles(),
             parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly),
             parameters.mapMode == MapMode::Still
-                ? parameters.stencilModeForClipping(tile.clip)
+                ? parameters.stencilModeForClipping(tile)
                 : gl::StencilMode::disabled(),
             parameters.colorModeForRenderPass(),
             CircleProgram::UniformValues {
@@ -88,11 +88,15 @@ void RenderCircleLayer::render(PaintParameters& parameters, RenderSource*) {
             bucket.paintPropertyBinders.at(getID()),
             evaluated,
             parameters.state.getZoom(),
-            getID()
+            getRenderIndex()
         );
     }
 }
 
+void RenderCircleLayer::preparePrograms(Programs& programs) {
+    programs.circle.get(evaluated);
+}
+
 bool RenderCircleLayer::queryIntersectsFeature(
         const GeometryCoordinates& queryGeometry,
         const GeometryTileFeature& feature,
@@ -86,7 +86,7 @@ void RenderFillExtrusionLayer::render(PaintParameters& parameters, RenderSource*
                 bucket.paintPropertyBinders.at(getID()),
                 evaluated,
                 parameters.state.getZoom(),
-                getID());
+                getRenderIndex());
         }
     } else {
         optional<ImagePosition> imagePosA = parameters.imageManager.getPattern(evaluated.get<FillExtrusionPattern>().from);
@@ -127,7 +127,7 @@ void RenderFillExtrusionLayer::render(PaintParameters& parameters, RenderSource*
                 bucket.paintPropertyBinders.at(getID()),
                 evaluated,
                 parameters.state.getZoom(),
-                getID());
+                getRenderIndex());
         }
     }
 
@@ -156,7 +156,18 @@ void RenderFillExtrusionLayer::render(PaintParameters& parameters, RenderSource*
         ExtrusionTextureProgram::PaintPropertyBinders{ properties, 0 },
         properties,
         parameters.state.getZoom(),
-        getID());
+        getRenderIndex());
+}
+
+void RenderFillExtrusionLayer::preparePrograms(Programs& programs) {
+    // Zoom-dependent patterns may not apply at the current zoom level yet, so the pattern program
+    // is prepared whenever the layer has a pattern.
+    if (evaluated.get<FillExtrusionPattern>().from.empty()) {
+        programs.fillExtrusion.get(evaluated);
+    }
+    if (!unevaluated.get<FillExtrusionPattern>().isUndefined()) {
+        programs.fillExtrusionPattern.get(evaluated);
+    }
 }
 
 bool RenderFillExtrusionLayer::queryIntersectsFeature(
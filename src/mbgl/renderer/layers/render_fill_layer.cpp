@@ -61,6 +61,10 @@ bool RenderFillLayer::hasTransition() const {
 void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
     if (evaluated.get<FillPattern>().from.empty()) {
         for (const RenderTile& tile : renderTiles) {
+            if (tile.culled) {
+                continue;
+            }
+
             assert(dynamic_cast<FillBucket*>(tile.tile.getBucket(*baseImpl)));
             FillBucket& bucket = *reinterpret_cast<FillBucket*>(tile.tile.getBucket(*baseImpl));
 
@@ -73,7 +77,7 @@ void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
                     parameters.context,
                     drawMode,
                     depthMode,
-                    parameters.stencilModeForClipping(tile.clip),
+                    parameters.stencilModeForClipping(tile),
                     parameters.colorModeForRenderPass(),
                     FillProgram::UniformValues {
                         uniforms::u_matrix::Value{
@@ -89,7 +93,7 @@ void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
                     bucket.paintPropertyBinders.at(getID()),
                     evaluated,
                     parameters.state.getZoom(),
-                    getID()
+                    getRenderIndex()
                 );
             };
 
@@ -129,6 +133,10 @@ void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
         parameters.imageManager.bind(parameters.context, 0);
 
         for (const RenderTile& tile : renderTiles) {
+            if (tile.culled) {
+                continue;
+            }
+
             assert(dynamic_cast<FillBucket*>(tile.tile.getBucket(*baseImpl)));
             FillBucket& bucket = *reinterpret_cast<FillBucket*>(tile.tile.getBucket(*baseImpl));
 
@@ -141,7 +149,7 @@ void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
                     parameters.context,
                     drawMode,
                     depthMode,
-                    parameters.stencilModeForClipping(tile.clip),
+                    parameters.stencilModeForClipping(tile),
                     parameters.colorModeForRenderPass(),
                     FillPatternUniforms::values(
                         tile.translatedMatrix(evaluated.get<FillTranslate>(),
@@ -161,7 +169,7 @@ void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
                     bucket.paintPropertyBinders.at(getID()),
                     evaluated,
                     parameters.state.getZoom(),
-                    getID()
+                    getRenderIndex()
                 );
             };
 
@@ -182,6 +190,20 @@ void RenderFillLayer::render(PaintParameters& parameters, RenderSource*) {
     }
 }
 
+void RenderFillLayer::preparePrograms(Programs& programs) {
+    if (evaluated.get<FillPattern>().from.empty()) {
+        programs.fill.get(evaluated);
+        if (evaluated.get<FillAntialias>()) {
+            programs.fillOutline.get(evaluated);
+        }
+    } else {
+        programs.fillPattern.get(evaluated);
+        if (evaluated.get<FillAntialias>() && unevaluated.get<FillOutlineColor>().isUndefined()) {
+            programs.fillOutlinePattern.get(evaluated);
+        }
+    }
+}
+
 bool RenderFillLayer::queryIntersectsFeature(
         const GeometryCoordinates& queryGeometry,
         const GeometryTileFeature& feature,
@@ -58,6 +58,10 @@ void RenderLineLayer::render(PaintParameters& parameters, RenderSource*) {
     }
 
     for (const RenderTile& tile : renderTiles) {
+        if (tile.culled) {
+            continue;
+        }
+
         assert(dynamic_cast<LineBucket*>(tile.tile.getBucket(*baseImpl)));
         LineBucket& bucket = *reinterpret_cast<LineBucket*>(tile.tile.getBucket(*baseImpl));
 
@@ -66,7 +70,7 @@ void RenderLineLayer::render(PaintParameters& parameters, RenderSource*) {
                 parameters.context,
                 gl::Triangles(),
                 parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly),
-                parameters.stencilModeForClipping(tile.clip),
+                parameters.stencilModeForClipping(tile),
                 parameters.colorModeForRenderPass(),
                 std::move(uniformValues),
                 *bucket.vertexBuffer,
@@ -75,7 +79,7 @@ void RenderLineLayer::render(PaintParameters& parameters, RenderSource*) {
                 bucket.paintPropertyBinders.at(getID()),
                 evaluated,
                 parameters.state.getZoom(),
-                getID()
+                getRenderIndex()
             );
         };
 
@@ -158,6 +162,16 @@ optional<GeometryCollection> offsetLine(const GeometryCollection& rings, const d
     return newRings;
 }
 
+void RenderLineLayer::preparePrograms(Programs& programs) {
+    if (!evaluated.get<LineDasharray>().from.empty()) {
+        programs.lineSDF.get(evaluated);
+    } else if (!evaluated.get<LinePattern>().from.empty()) {
+        programs.linePattern.get(evaluated);
+    } else {
+        programs.line.get(evaluated);
+    }
+}
+
 bool RenderLineLayer::queryIntersectsFeature(
         const GeometryCoordinates& queryGeometry,
         const GeometryTileFeature& feature,
@@ -24,6 +24,7 @@ public:
     void evaluate(const PropertyEvaluationParameters&) override;
     bool hasTransition() const override;
     void render(PaintParameters&, RenderSource*) override;
+    void preparePrograms(Programs&) override;
 
     bool queryIntersectsFeature(
             const GeometryCoordinates&,
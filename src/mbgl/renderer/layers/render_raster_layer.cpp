@@ -104,7 +104,7 @@ void RenderRasterLayer::render(PaintParameters& parameters, RenderSource* source
             RasterProgram::PaintPropertyBinders { evaluated, 0 },
             evaluated,
             parameters.state.getZoom(),
-            getID()
+            getRenderIndex()
         );
     };
 
@@ -125,6 +125,10 @@ void RenderRasterLayer::render(PaintParameters& parameters, RenderSource* source
         }
     } else {
         for (const RenderTile& tile : renderTiles) {
+            if (tile.culled) {
+                continue;
+            }
+
             assert(dynamic_cast<RasterBucket*>(tile.tile.getBucket(*baseImpl)));
             RasterBucket& bucket = *reinterpret_cast<RasterBucket*>(tile.tile.getBucket(*baseImpl));
 
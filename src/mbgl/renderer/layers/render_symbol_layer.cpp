@@ -101,7 +101,7 @@ void RenderSymbolLayer::render(PaintParameters& parameters, RenderSource*) {
                     ? parameters.depthModeForSublayer(0, gl::DepthMode::ReadOnly)
                     : gl::DepthMode::disabled(),
                 needsClipping
-                    ? parameters.stencilModeForClipping(tile.clip)
+                    ? parameters.stencilModeForClipping(tile)
                     : gl::StencilMode::disabled(),
                 parameters.colorModeForRenderPass(),
                 std::move(uniformValues),
@@ -113,7 +113,7 @@ void RenderSymbolLayer::render(PaintParameters& parameters, RenderSource*) {
                 binders,
                 paintProperties,
                 parameters.state.getZoom(),
-                getID()
+                getRenderIndex()
             );
         };
 
@@ -233,7 +233,7 @@ void RenderSymbolLayer::render(PaintParameters& parameters, RenderSource*) {
                 parameters.context,
                 gl::Lines { 1.0f },
                 gl::DepthMode::disabled(),
-                parameters.stencilModeForClipping(tile.clip),
+                parameters.stencilModeForClipping(tile),
                 parameters.colorModeForRenderPass(),
                 CollisionBoxProgram::UniformValues {
                     uniforms::u_matrix::Value{ tile.matrix },
@@ -251,12 +251,30 @@ void RenderSymbolLayer::render(PaintParameters& parameters, RenderSource*) {
                 paintAttributeData,
                 properties,
                 parameters.state.getZoom(),
-                getID()
+                getRenderIndex()
             );
         }
     }
 }
 
+void RenderSymbolLayer::preparePrograms(Programs& programs) {
+    // Whether icons are SDF images is only known once the bucket is laid out. Plain icons are far
+    // more common, but icon colors and halos only apply to SDF icons, so layers that set them are
+    // expected to use SDF images.
+    if (!impl().layout.get<IconImage>().isUndefined()) {
+        programs.symbolIcon.get(iconPaintProperties());
+        if (!unevaluated.get<IconColor>().isUndefined() ||
+            !unevaluated.get<IconHaloColor>().isUndefined() ||
+            !unevaluated.get<IconHaloWidth>().isUndefined()) {
+            programs.symbolIconSDF.get(iconPaintProperties());
+        }
+    }
+
+    if (!impl().layout.get<TextField>().isUndefined()) {
+        programs.symbolGlyph.get(textPaintProperties());
+    }
+}
+
 style::IconPaintProperties::PossiblyEvaluated RenderSymbolLayer::iconPaintProperties() const {
     return style::IconPaintProperties::PossiblyEvaluated {
             evaluated.get<style::IconOpacity>(),
@@ -2,6 +2,7 @@
 #include <mbgl/renderer/update_parameters.hpp>
 #include <mbgl/renderer/render_style.hpp>
 #include <mbgl/renderer/render_static_data.hpp>
+#include <mbgl/renderer/render_tile.hpp>
 #include <mbgl/map/transform_state.hpp>
 
 namespace mbgl {
@@ -61,14 +62,21 @@ gl::DepthMode PaintParameters::depthModeForSublayer(uint8_t n, gl::DepthMode::Ma
     return gl::DepthMode { gl::DepthMode::LessEqual, mask, { nearDepth, farDepth } };
 }
 
-gl::StencilMode PaintParameters::stencilModeForClipping(const ClipID& id) const {
+gl::StencilMode PaintParameters::stencilModeForClipping(const RenderTile& tile) const {
+    if (scissorClipping) {
+        auto mode = gl::StencilMode::disabled();
+        mode.scissor = tile.scissor;
+        return mode;
+    }
+
     return gl::StencilMode {
-        gl::StencilMode::Equal { static_cast<uint32_t>(id.mask.to_ulong()) },
-        static_cast<int32_t>(id.reference.to_ulong()),
+        gl::StencilMode::Equal { static_cast<uint32_t>(tile.clip.mask.to_ulong()) },
+        static_cast<int32_t>(tile.clip.reference.to_ulong()),
         0,
         gl::StencilMode::Keep,
         gl::StencilMode::Keep,
-        gl::StencilMode::Replace
+        gl::StencilMode::Replace,
+        {}
     };
 }
 
@@ -23,6 +23,7 @@ class TransformState;
 class ImageManager;
 class LineAtlas;
 class UnwrappedTileID;
+class RenderTile;
 
 class PaintParameters {
 public:
@@ -56,10 +57,15 @@ public:
     std::array<float, 2> pixelsToGLUnits;
     algorithm::ClipIDGenerator clipIDGenerator;
 
+    // Whether tiles are clipped with scissor rectangles instead of masks in the stencil buffer.
+    // This is only possible when no tile overlaps another one of the same source and all tiles
+    // are axis-aligned rectangles on screen.
+    bool scissorClipping = false;
+
     Programs& programs;
 
     gl::DepthMode depthModeForSublayer(uint8_t n, gl::DepthMode::Mask) const;
-    gl::StencilMode stencilModeForClipping(const ClipID&) const;
+    gl::StencilMode stencilModeForClipping(const RenderTile&) const;
     gl::ColorMode colorModeForRenderPass() const;
 
     mat4 matrixForTile(const UnwrappedTileID&);
@@ -7,8 +7,10 @@
 #include <mbgl/util/type_list.hpp>
 #include <mbgl/renderer/possibly_evaluated_property_value.hpp>
 #include <mbgl/renderer/paint_property_statistics.hpp>
+#include <mbgl/math/clamp.hpp>
 
 #include <bitset>
+#include <limits>
 
 namespace mbgl {
 
@@ -19,29 +21,44 @@ namespace mbgl {
    being zoomed.
 */
 template <class A>
-using ZoomInterpolatedAttributeType = gl::Attribute<typename A::ValueType, A::Dimensions * 2>;
+using ZoomInterpolatedAttributeType = gl::Attribute<typename A::ValueType, A::Dimensions * 2, A::Normalized>;
 
-inline std::array<float, 1> attributeValue(float v) {
+inline std::array<float, 1> attributeValue(float v, std::false_type /* normalized */) {
     return {{ v }};
 }
 
 /*
-    Encode a four-component color value into a pair of floats.  Since csscolorparser
-    uses 8-bit precision for each color component, for each float we use the upper 8
+    Encode a value in 0..1, such as an opacity, as a 16-bit normalized integer. The GPU
+    maps it back to 0..1 when reading the attribute.
+*/
+inline std::array<uint16_t, 1> attributeValue(float v, std::true_type /* normalized */) {
+    return {{ static_cast<uint16_t>(util::clamp(v, 0.0f, 1.0f) * std::numeric_limits<uint16_t>::max() + 0.5f) }};
+}
+
+/*
+    Encode a four-component color value into a pair of 16-bit integers.  Since csscolorparser
+    uses 8-bit precision for each color component, for each integer we use the upper 8
     bits for one component (e.g. (color.r * 255) * 256), and the lower 8 for another.
+    The shader receives them as floats holding the same values.
     
     Also note that colors come in as floats 0..1, so we scale by 255.
 */
-inline std::array<float, 2> attributeValue(const Color& color) {
+inline std::array<uint16_t, 2> attributeValue(const Color& color, std::false_type /* normalized */) {
     return {{
-        static_cast<float>(mbgl::attributes::packUint8Pair(255 * color.r, 255 * color.g)),
-        static_cast<float>(mbgl::attributes::packUint8Pair(255 * color.b, 255 * color.a))
+        mbgl::attributes::packUint8Pair(255 * color.r, 255 * color.g),
+        mbgl::attributes::packUint8Pair(255 * color.b, 255 * color.a)
     }};
 }
 
-template <size_t N>
-std::array<float, N*2> zoomInterpolatedAttributeValue(const std::array<float, N>& min, const std::array<float, N>& max) {
-    std::array<float, N*2> result;
+// Encodes an evaluated paint property value as a value of attribute A.
+template <class A, class T>
+typename A::Value attributeValue(const T& v) {
+    return attributeValue(v, std::integral_constant<bool, A::Normalized>());
+}
+
+template <class T, size_t N>
+std::array<T, N*2> zoomInterpolatedAttributeValue(const std::array<T, N>& min, const std::array<T, N>& max) {
+    std::array<T, N*2> result;
     for (size_t i = 0; i < N; i++) {
         result[i]   = min[i];
         result[i+N] = max[i];
@@ -120,12 +137,25 @@ private:
     T constant;
 };
 
+/*
+    Vertex of a single paint attribute value, aligned to four bytes. Some GL implementations fall
+    back to slow paths for vertex strides that aren't a multiple of four bytes, so values made up
+    of a single 16-bit integer, such as normalized opacities, are padded.
+*/
+template <class A>
+class alignas(4) PaintAttributeVertex : public gl::detail::Vertex<A> {
+public:
+    PaintAttributeVertex(typename A::Value value) {
+        this->a1 = value;
+    }
+};
+
 template <class T, class A>
 class SourceFunctionPaintPropertyBinder : public PaintPropertyBinder<T, A> {
 public:
     using BaseAttribute = A;
     using BaseAttributeValue = typename BaseAttribute::Value;
-    using BaseVertex = gl::detail::Vertex<BaseAttribute>;
+    using BaseVertex = PaintAttributeVertex<BaseAttribute>;
 
     using Attribute = ZoomInterpolatedAttributeType<A>;
     using AttributeBinding = typename Attribute::Binding;
@@ -138,7 +168,7 @@ public:
     void populateVertexVector(const GeometryTileFeature& feature, std::size_t length) override {
         auto evaluated = function.evaluate(feature, defaultValue);
         this->statistics.add(evaluated);
-        auto value = attributeValue(evaluated);
+        auto value = attributeValue<BaseAttribute>(evaluated);
         for (std::size_t i = vertexVector.vertexSize(); i < length; ++i) {
             vertexVector.emplace_back(BaseVertex { value });
         }
@@ -198,8 +228,8 @@ public:
         this->statistics.add(range.min);
         this->statistics.add(range.max);
         AttributeValue value = zoomInterpolatedAttributeValue(
-            attributeValue(range.min),
-            attributeValue(range.max));
+            attributeValue<BaseAttribute>(range.min),
+            attributeValue<BaseAttribute>(range.max));
         for (std::size_t i = vertexVector.vertexSize(); i < length; ++i) {
             vertexVector.emplace_back(Vertex { value });
         }
@@ -15,6 +15,7 @@ class BucketParameters;
 class TransitionParameters;
 class PropertyEvaluationParameters;
 class PaintParameters;
+class Programs;
 class RenderSource;
 class RenderTile;
 
@@ -55,6 +56,11 @@ public:
 
     const std::string& getID() const;
 
+    // Dense index of this layer among the layers of its style, assigned by RenderStyle. Used
+    // instead of the ID to look up per-layer state on the hot path of draw calls.
+    std::size_t getRenderIndex() const { return renderIndex; }
+    void setRenderIndex(std::size_t index) { renderIndex = index; }
+
     // Checks whether this layer needs to be rendered in the given render pass.
     bool hasRenderPass(RenderPass) const;
 
@@ -63,6 +69,10 @@ public:
 
     virtual void render(PaintParameters&, RenderSource*) = 0;
 
+    // Compiles the program variants this layer is expected to draw with, so that they don't
+    // have to be compiled in the middle of a frame once the layer becomes visible.
+    virtual void preparePrograms(Programs&) {}
+
     // Check wether the given geometry intersects
     // with the feature
     virtual bool queryIntersectsFeature(
@@ -89,6 +99,8 @@ protected:
     //Stores current set of tiles to be rendered for this layer.
     std::vector<std::reference_wrapper<RenderTile>> renderTiles;
 
+private:
+    std::size_t renderIndex = 0;
 };
 
 } // namespace mbgl
@@ -5,6 +5,7 @@
 #include <mbgl/util/mat4.hpp>
 #include <mbgl/util/geo.hpp>
 #include <mbgl/util/feature.hpp>
+#include <mbgl/renderer/query.hpp>
 #include <mbgl/style/source_impl.hpp>
 #include <mbgl/style/layer_impl.hpp>
 
@@ -20,8 +21,6 @@ class TransformState;
 class RenderTile;
 class RenderStyle;
 class RenderLayer;
-class RenderedQueryOptions;
-class SourceQueryOptions;
 class Tile;
 class RenderSourceObserver;
 class TileParameters;
@@ -57,8 +56,11 @@ public:
     virtual void startRender(PaintParameters&) = 0;
     virtual void finishRender(PaintParameters&) = 0;
 
-    // Returns an unsorted list of RenderTiles.
-    virtual std::vector<std::reference_wrapper<RenderTile>> getRenderTiles() = 0;
+    // Returns the RenderTiles sorted by tile ID.
+    virtual const std::vector<std::reference_wrapper<RenderTile>>& getRenderTiles() = 0;
+
+    // Returns the RenderTiles in the order symbol layers draw them at the given bearing.
+    virtual const std::vector<std::reference_wrapper<RenderTile>>& getSymbolSortedRenderTiles(float angle) = 0;
 
     virtual std::unordered_map<std::string, std::vector<Feature>>
     queryRenderedFeatures(const ScreenLineString& geometry,
@@ -66,6 +68,13 @@ public:
                           const RenderStyle& style,
                           const RenderedQueryOptions& options) const = 0;
 
+    // Streams the features to the callback. Returns false if the callback stopped the query.
+    virtual bool queryRenderedFeatures(const ScreenLineString& geometry,
+                                       const TransformState& transformState,
+                                       const RenderStyle& style,
+                                       const RenderedQueryOptions& options,
+                                       const RenderedFeatureCallback& callback) const = 0;
+
     virtual std::vector<Feature>
     querySourceFeatures(const SourceQueryOptions&) const = 0;
 
@@ -19,6 +19,7 @@
 #include <mbgl/renderer/style_diff.hpp>
 #include <mbgl/renderer/image_manager.hpp>
 #include <mbgl/renderer/query.hpp>
+#include <mbgl/programs/segment.hpp>
 #include <mbgl/style/style.hpp>
 #include <mbgl/style/source_impl.hpp>
 #include <mbgl/style/transition_options.hpp>
@@ -26,26 +27,32 @@
 #include <mbgl/text/glyph_manager.hpp>
 #include <mbgl/geometry/line_atlas.hpp>
 #include <mbgl/tile/tile.hpp>
+#include <mbgl/tile/layout_cache.hpp>
 #include <mbgl/util/math.hpp>
 #include <mbgl/util/string.hpp>
 #include <mbgl/util/logging.hpp>
 
+#include <algorithm>
+
 namespace mbgl {
 
 using namespace style;
 
 RenderStyleObserver nullObserver;
 
-RenderStyle::RenderStyle(Scheduler& scheduler_, FileSource& fileSource_)
+RenderStyle::RenderStyle(Scheduler& scheduler_, FileSource& fileSource_, const optional<std::string>& layoutCacheDir)
     : scheduler(scheduler_),
       fileSource(fileSource_),
       glyphManager(std::make_unique<GlyphManager>(fileSource)),
       imageManager(std::make_unique<ImageManager>()),
       lineAtlas(std::make_unique<LineAtlas>(Size{ 256, 512 })),
+      layoutCache(layoutCacheDir ? std::make_shared<LayoutCache>(*layoutCacheDir) : nullptr),
       imageImpls(makeMutable<std::vector<Immutable<style::Image::Impl>>>()),
       sourceImpls(makeMutable<std::vector<Immutable<style::Source::Impl>>>()),
       layerImpls(makeMutable<std::vector<Immutable<style::Layer::Impl>>>()),
       renderLight(makeMutable<Light::Impl>()),
+      nextRenderIndex(firstLayerVertexArrayIndex),
+      layerTransitionsPending(false),
       observer(&nullObserver) {
     glyphManager->setObserver(this);
 }
@@ -107,7 +114,8 @@ void RenderStyle::update(const UpdateParameters& parameters) {
         parameters.annotationManager,
         *imageManager,
         *glyphManager,
-        parameters.prefetchZoomDelta
+        parameters.prefetchZoomDelta,
+        layoutCache
     };
 
     glyphManager->setURL(parameters.glyphURL);
@@ -125,8 +133,17 @@ void RenderStyle::update(const UpdateParameters& parameters) {
     }
 
 
-    const ImageDifference imageDiff = diffImages(imageImpls, parameters.images);
-    imageImpls = parameters.images;
+    // The style's collections keep their identity until they're mutated, so an unchanged pointer
+    // means there is nothing to diff. Camera-only updates skip straight to evaluation and tile cover.
+    const bool imagesChanged = imageImpls != parameters.images;
+    const bool layersChanged = layerImpls != parameters.layers;
+    const bool sourcesChanged = sourceImpls != parameters.sources;
+
+    ImageDifference imageDiff;
+    if (imagesChanged) {
+        imageDiff = diffImages(imageImpls, parameters.images);
+        imageImpls = parameters.images;
+    }
 
     // Remove removed images from sprite atlas.
     for (const auto& entry : imageDiff.removed) {
@@ -145,43 +162,72 @@ void RenderStyle::update(const UpdateParameters& parameters) {
 
     imageManager->setLoaded(parameters.spriteLoaded);
 
+    const bool imagesDiffer = !imageDiff.added.empty() ||
+                              !imageDiff.removed.empty() ||
+                              !imageDiff.changed.empty();
+
 
-    const LayerDifference layerDiff = diffLayers(layerImpls, parameters.layers);
-    layerImpls = parameters.layers;
+    LayerDifference layerDiff;
+    if (layersChanged) {
+        layerDiff = diffLayers(layerImpls, parameters.layers);
+        layerImpls = parameters.layers;
+    }
 
     // Remove render layers for removed layers.
     for (const auto& entry : layerDiff.removed) {
-        renderLayers.erase(entry.first);
+        auto it = renderLayers.find(entry.first);
+        freeRenderIndices.push_back(it->second->getRenderIndex());
+        renderLayers.erase(it);
     }
 
     // Create render layers for newly added layers.
     for (const auto& entry : layerDiff.added) {
-        renderLayers.emplace(entry.first, RenderLayer::create(entry.second));
+        std::unique_ptr<RenderLayer> renderLayer = RenderLayer::create(entry.second);
+        if (freeRenderIndices.empty()) {
+            renderLayer->setRenderIndex(nextRenderIndex++);
+        } else {
+            renderLayer->setRenderIndex(freeRenderIndices.back());
+            freeRenderIndices.pop_back();
+        }
+        renderLayers.emplace(entry.first, std::move(renderLayer));
+        addUnpreparedLayer(entry.first);
     }
 
     // Update render layers for changed layers.
     for (const auto& entry : layerDiff.changed) {
         renderLayers.at(entry.first)->setImpl(entry.second.after);
+        addUnpreparedLayer(entry.first);
     }
 
     // Update layers for class and zoom changes.
-    for (const auto& entry : renderLayers) {
-        RenderLayer& layer = *entry.second;
-        const bool layerAdded = layerDiff.added.count(entry.first);
-        const bool layerChanged = layerDiff.changed.count(entry.first);
+    if (layersChanged || zoomChanged || layerTransitionsPending) {
+        layerTransitionsPending = false;
 
-        if (layerAdded || layerChanged) {
-            layer.transition(transitionParameters);
-        }
+        for (const auto& entry : renderLayers) {
+            RenderLayer& layer = *entry.second;
+            const bool layerAdded = layerDiff.added.count(entry.first);
+            const bool layerChanged = layerDiff.changed.count(entry.first);
+
+            if (layerAdded || layerChanged) {
+                layer.transition(transitionParameters);
+            }
+
+            if (layerAdded || layerChanged || zoomChanged || layer.hasTransition()) {
+                layer.evaluate(evaluationParameters);
+            }
 
-        if (layerAdded || layerChanged || zoomChanged || layer.hasTransition()) {
-            layer.evaluate(evaluationParameters);
+            if (layer.hasTransition()) {
+                layerTransitionsPending = true;
+            }
         }
     }
 
 
-    const SourceDifference sourceDiff = diffSources(sourceImpls, parameters.sources);
-    sourceImpls = parameters.sources;
+    SourceDifference sourceDiff;
+    if (sourcesChanged) {
+        sourceDiff = diffSources(sourceImpls, parameters.sources);
+        sourceImpls = parameters.sources;
+    }
 
     // Remove render layers for removed sources.
     for (const auto& entry : sourceDiff.removed) {
@@ -195,36 +241,50 @@ void RenderStyle::update(const UpdateParameters& parameters) {
         renderSources.emplace(entry.first, std::move(renderSource));
     }
 
+    // Rebuild the per-source layer lists only when the layers or sources themselves changed.
+    if (layersChanged || sourcesChanged) {
+        sourceLayers.clear();
+
+        for (const auto& source : *sourceImpls) {
+            SourceLayers& entry = sourceLayers[source->id];
+
+            for (const auto& layer : *layerImpls) {
+                if (layer->type == LayerType::Background ||
+                    layer->type == LayerType::Custom ||
+                    layer->source != source->id) {
+                    continue;
+                }
+
+                entry.layers.push_back(layer);
+                entry.renderLayers.push_back(getRenderLayer(layer->id));
+            }
+        }
+    }
+
     // Update all sources.
     for (const auto& source : *sourceImpls) {
-        std::vector<Immutable<Layer::Impl>> filteredLayers;
+        const SourceLayers& entry = sourceLayers.at(source->id);
         bool needsRendering = false;
-        bool needsRelayout = false;
+        bool needsRelayout = imagesDiffer && !entry.layers.empty();
 
-        for (const auto& layer : *layerImpls) {
-            if (layer->type == LayerType::Background ||
-                layer->type == LayerType::Custom ||
-                layer->source != source->id) {
-                continue;
-            }
-
-            if (!needsRendering && getRenderLayer(layer->id)->needsRendering(zoomHistory.lastZoom)) {
+        for (const RenderLayer* layer : entry.renderLayers) {
+            if (layer->needsRendering(zoomHistory.lastZoom)) {
                 needsRendering = true;
+                break;
             }
+        }
 
-            if (!needsRelayout && (
-                hasLayoutDifference(layerDiff, layer->id) ||
-                !imageDiff.added.empty() ||
-                !imageDiff.removed.empty() ||
-                !imageDiff.changed.empty())) {
-                needsRelayout = true;
+        if (!needsRelayout && layersChanged) {
+            for (const auto& layer : entry.layers) {
+                if (hasLayoutDifference(layerDiff, layer->id)) {
+                    needsRelayout = true;
+                    break;
+                }
             }
-
-            filteredLayers.push_back(layer);
         }
 
         renderSources.at(source->id)->update(source,
-                                             filteredLayers,
+                                             entry.layers,
                                              needsRendering,
                                              needsRelayout,
                                              tileParameters);
@@ -311,24 +371,13 @@ RenderData RenderStyle::getRenderData(MapDebugOptions debugOptions, float angle)
 
         const bool symbolLayer = layer->is<RenderSymbolLayer>();
 
-        auto sortedTiles = source->getRenderTiles();
-        if (symbolLayer) {
-            // Sort symbol tiles in opposite y position, so tiles with overlapping symbols are drawn
-            // on top of each other, with lower symbols being drawn on top of higher symbols.
-            std::sort(sortedTiles.begin(), sortedTiles.end(),
-                      [angle](const RenderTile& a, const RenderTile& b) {
-                Point<float> pa(a.id.canonical.x, a.id.canonical.y);
-                Point<float> pb(b.id.canonical.x, b.id.canonical.y);
+        const auto& sortedTiles = symbolLayer
+            ? source->getSymbolSortedRenderTiles(angle)
+            : source->getRenderTiles();
 
-                auto par = util::rotate(pa, angle);
-                auto pbr = util::rotate(pb, angle);
-
-                return std::tie(par.y, par.x) < std::tie(pbr.y, pbr.x);
-            });
-        } else {
-            std::sort(sortedTiles.begin(), sortedTiles.end(),
-                      [](const auto& a, const auto& b) { return a.get().id < b.get().id; });
-        }
+        // For symbol layers, the lowest overscaled zoom of the tiles inserted so far, by
+        // canonical tile ID.
+        std::unordered_map<CanonicalTileID, uint8_t> insertedSymbolTiles;
 
         std::vector<std::reference_wrapper<RenderTile>> sortedTilesForInsertion;
         for (auto& sortedTile : sortedTiles) {
@@ -341,16 +390,14 @@ RenderData RenderStyle::getRenderData(MapDebugOptions debugOptions, float angle)
             // layers, we drop all children in favor of their parent to avoid duplicate labels.
             // See https://github.com/mapbox/mapbox-gl-native/issues/2482
             if (symbolLayer) {
+                // Look up the tile's ancestors among the tiles we decided to render for this layer.
+                // As in OverscaledTileID::isChildOf(), a tile with the same canonical ID but a
+                // lower overscaled zoom counts as a parent.
+                const OverscaledTileID& id = tile.tile.id;
                 bool skip = false;
-                // Look back through the buckets we decided to render to find out whether there is
-                // already a bucket from this layer that is a parent of this tile. Tiles are ordered
-                // by zoom level when we obtain them from getTiles().
-                for (auto it = sortedTilesForInsertion.rbegin();
-                     it != sortedTilesForInsertion.rend(); ++it) {
-                    if (tile.tile.id.isChildOf(it->get().tile.id)) {
-                        skip = true;
-                        break;
-                    }
+                for (int8_t z = id.canonical.z; z >= 0 && !skip; --z) {
+                    auto it = insertedSymbolTiles.find(id.canonical.scaledTo(z));
+                    skip = it != insertedSymbolTiles.end() && it->second < id.overscaledZ;
                 }
                 if (skip) {
                     continue;
@@ -361,6 +408,14 @@ RenderData RenderStyle::getRenderData(MapDebugOptions debugOptions, float angle)
             if (bucket) {
                 sortedTilesForInsertion.emplace_back(tile);
                 tile.used = true;
+
+                if (symbolLayer) {
+                    const OverscaledTileID& id = tile.tile.id;
+                    auto inserted = insertedSymbolTiles.emplace(id.canonical, id.overscaledZ);
+                    if (!inserted.second) {
+                        inserted.first->second = std::min(inserted.first->second, id.overscaledZ);
+                    }
+                }
             }
         }
         layer->setRenderTiles(std::move(sortedTilesForInsertion));
@@ -370,10 +425,25 @@ RenderData RenderStyle::getRenderData(MapDebugOptions debugOptions, float angle)
     return result;
 }
 
-std::vector<Feature> RenderStyle::queryRenderedFeatures(const ScreenLineString& geometry,
-                                                  const TransformState& transformState,
-                                                  const RenderedQueryOptions& options) const {
-    std::unordered_map<std::string, std::vector<Feature>> resultsByLayer;
+void RenderStyle::addUnpreparedLayer(const std::string& id) {
+    // Layers that change repeatedly before they are prepared, e.g. during an animation driven by
+    // setPaintProperty, are only queued once.
+    if (std::find(unpreparedLayers.begin(), unpreparedLayers.end(), id) == unpreparedLayers.end()) {
+        unpreparedLayers.push_back(id);
+    }
+}
+
+void RenderStyle::preparePrograms(Programs& programs, TimePoint deadline) {
+    while (!unpreparedLayers.empty() && Clock::now() < deadline) {
+        if (RenderLayer* layer = getRenderLayer(unpreparedLayers.back())) {
+            layer->preparePrograms(programs);
+        }
+        unpreparedLayers.pop_back();
+    }
+}
+
+std::vector<const RenderSource*> RenderStyle::getQueriedSources(const RenderedQueryOptions& options) const {
+    std::vector<const RenderSource*> result;
 
     if (options.layerIDs) {
         std::unordered_set<std::string> sourceIDs;
@@ -384,17 +454,28 @@ std::vector<Feature> RenderStyle::queryRenderedFeatures(const ScreenLineString&
         }
         for (const auto& sourceID : sourceIDs) {
             if (RenderSource* renderSource = getRenderSource(sourceID)) {
-                auto sourceResults = renderSource->queryRenderedFeatures(geometry, transformState, *this, options);
-                std::move(sourceResults.begin(), sourceResults.end(), std::inserter(resultsByLayer, resultsByLayer.begin()));
+                result.push_back(renderSource);
             }
         }
     } else {
         for (const auto& entry : renderSources) {
-            auto sourceResults = entry.second->queryRenderedFeatures(geometry, transformState, *this, options);
-            std::move(sourceResults.begin(), sourceResults.end(), std::inserter(resultsByLayer, resultsByLayer.begin()));
+            result.push_back(entry.second.get());
         }
     }
 
+    return result;
+}
+
+std::vector<Feature> RenderStyle::queryRenderedFeatures(const ScreenLineString& geometry,
+                                                  const TransformState& transformState,
+                                                  const RenderedQueryOptions& options) const {
+    std::unordered_map<std::string, std::vector<Feature>> resultsByLayer;
+
+    for (const RenderSource* renderSource : getQueriedSources(options)) {
+        auto sourceResults = renderSource->queryRenderedFeatures(geometry, transformState, *this, options);
+        std::move(sourceResults.begin(), sourceResults.end(), std::inserter(resultsByLayer, resultsByLayer.begin()));
+    }
+
     std::vector<Feature> result;
 
     if (resultsByLayer.empty()) {
@@ -416,6 +497,22 @@ std::vector<Feature> RenderStyle::queryRenderedFeatures(const ScreenLineString&
     return result;
 }
 
+void RenderStyle::queryRenderedFeatures(const ScreenLineString& geometry,
+                                        const TransformState& transformState,
+                                        const RenderedQueryOptions& options,
+                                        const RenderedFeatureCallback& callback) const {
+    const RenderedFeatureCallback renderedCallback = [&] (const std::string& layerID, Feature&& feature) {
+        const RenderLayer* layer = getRenderLayer(layerID);
+        return !layer->needsRendering(zoomHistory.lastZoom) || callback(layerID, std::move(feature));
+    };
+
+    for (const RenderSource* renderSource : getQueriedSources(options)) {
+        if (!renderSource->queryRenderedFeatures(geometry, transformState, *this, options, renderedCallback)) {
+            return;
+        }
+    }
+}
+
 void RenderStyle::onLowMemory() {
     for (const auto& entry : renderSources) {
         entry.second->onLowMemory();
@@ -8,9 +8,13 @@
 #include <mbgl/text/glyph_manager_observer.hpp>
 #include <mbgl/map/zoom_history.hpp>
 #include <mbgl/map/mode.hpp>
+#include <mbgl/util/chrono.hpp>
+#include <mbgl/util/optional.hpp>
 
+#include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace mbgl {
@@ -18,10 +22,11 @@ namespace mbgl {
 class FileSource;
 class GlyphManager;
 class ImageManager;
+class LayoutCache;
 class LineAtlas;
 class RenderData;
 class TransformState;
-class RenderedQueryOptions;
+class Programs;
 class Scheduler;
 class UpdateParameters;
 class RenderStyleObserver;
@@ -35,7 +40,7 @@ class Layer;
 class RenderStyle : public GlyphManagerObserver,
                     public RenderSourceObserver {
 public:
-    RenderStyle(Scheduler&, FileSource&);
+    RenderStyle(Scheduler&, FileSource&, const optional<std::string>& layoutCacheDir = {});
     ~RenderStyle() final;
 
     void setObserver(RenderStyleObserver*);
@@ -55,10 +60,21 @@ public:
 
     RenderData getRenderData(MapDebugOptions, float angle);
 
+    // Compiles the programs needed by layers that were added or changed since they were last
+    // prepared, stopping once the deadline has passed. Remaining layers are prepared on later calls.
+    void preparePrograms(Programs&, TimePoint deadline);
+
     std::vector<Feature> queryRenderedFeatures(const ScreenLineString& geometry,
                                                const TransformState& transformState,
                                                const RenderedQueryOptions& options) const;
 
+    // Streams the features to the callback as each tile is queried, without sorting them by layer,
+    // until the callback returns false.
+    void queryRenderedFeatures(const ScreenLineString& geometry,
+                               const TransformState& transformState,
+                               const RenderedQueryOptions& options,
+                               const RenderedFeatureCallback& callback) const;
+
     void onLowMemory();
 
     void dumpDebugLogs() const;
@@ -68,6 +84,7 @@ public:
     std::unique_ptr<GlyphManager> glyphManager;
     std::unique_ptr<ImageManager> imageManager;
     std::unique_ptr<LineAtlas> lineAtlas;
+    std::shared_ptr<LayoutCache> layoutCache;
 
 private:
     Immutable<std::vector<Immutable<style::Image::Impl>>> imageImpls;
@@ -78,6 +95,27 @@ private:
     std::unordered_map<std::string, std::unique_ptr<RenderLayer>> renderLayers;
     RenderLight renderLight;
 
+    // Render indices of removed layers, handed out again to keep indices dense.
+    std::vector<std::size_t> freeRenderIndices;
+    std::size_t nextRenderIndex;
+
+    // Whether any layer was still transitioning after the last update.
+    bool layerTransitionsPending;
+
+    // Layers rendered from each source, in style order. Rebuilt only when the style's layers or
+    // sources change.
+    struct SourceLayers {
+        std::vector<Immutable<style::Layer::Impl>> layers;
+        std::vector<const RenderLayer*> renderLayers;
+    };
+    std::unordered_map<std::string, SourceLayers> sourceLayers;
+
+    // IDs of layers whose programs haven't been prepared yet, without duplicates.
+    std::vector<std::string> unpreparedLayers;
+    void addUnpreparedLayer(const std::string&);
+
+    std::vector<const RenderSource*> getQueriedSources(const RenderedQueryOptions&) const;
+
     // GlyphManagerObserver implementation.
     void onGlyphsError(const FontStack&, const GlyphRange&, std::exception_ptr) override;
 
@@ -5,7 +5,14 @@
 #include <mbgl/programs/programs.hpp>
 #include <mbgl/map/transform_state.hpp>
 #include <mbgl/tile/tile.hpp>
+#include <mbgl/util/constants.hpp>
 #include <mbgl/util/math.hpp>
+#include <mbgl/math/clamp.hpp>
+#include <mbgl/gl/context.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
 
 namespace mbgl {
 
@@ -52,6 +59,84 @@ mat4 RenderTile::translatedClipMatrix(const std::array<float, 2>& translation,
     return translateVtxMatrix(nearClippedMatrix, translation, anchor, state, false);
 }
 
+// Projects the tile's corners to the framebuffer and tests their bounding box against it. Tiles
+// that are drawn are clipped to their bounds, and GL only generates fragments for pixels whose
+// center lies within a primitive. So a tile whose bounding box doesn't contain a pixel center,
+// such as a sliver near the horizon in pitched views, doesn't affect the image. Tiles smaller
+// than a pixel that do contain a pixel center are kept; skipping them leaves gaps.
+bool RenderTile::isCulled(const mat4& tileMatrix, const Size& size) {
+    double minX = std::numeric_limits<double>::infinity();
+    double minY = std::numeric_limits<double>::infinity();
+    double maxX = -std::numeric_limits<double>::infinity();
+    double maxY = -std::numeric_limits<double>::infinity();
+
+    for (const auto& corner : { Point<double>(0, 0), Point<double>(util::EXTENT, 0),
+                                Point<double>(0, util::EXTENT), Point<double>(util::EXTENT, util::EXTENT) }) {
+        const double w = tileMatrix[3] * corner.x + tileMatrix[7] * corner.y + tileMatrix[15];
+        if (w <= 0) {
+            // The corner is behind the camera, so the projected bounds aren't meaningful.
+            return false;
+        }
+        const double x = ((tileMatrix[0] * corner.x + tileMatrix[4] * corner.y + tileMatrix[12]) / w + 1) / 2 * size.width;
+        const double y = ((tileMatrix[1] * corner.x + tileMatrix[5] * corner.y + tileMatrix[13]) / w + 1) / 2 * size.height;
+        minX = std::min(minX, x);
+        minY = std::min(minY, y);
+        maxX = std::max(maxX, x);
+        maxY = std::max(maxY, y);
+    }
+
+    if (maxX < 0 || maxY < 0 || minX > size.width || minY > size.height) {
+        return true;
+    }
+
+    const auto containsPixelCenter = [](double min, double max) {
+        return std::floor(max - 0.5) >= std::ceil(min - 0.5);
+    };
+    return !containsPixelCenter(minX, maxX) || !containsPixelCenter(minY, maxY);
+}
+
+// Projects the tile's corners to framebuffer coordinates and returns the rectangle they span, if
+// the tile's edges are parallel to the framebuffer's.
+static optional<gl::StencilMode::Scissor> scissorFor(const mat4& tileMatrix, const gl::value::Viewport::Type& viewport) {
+    std::array<Point<double>, 4> corners {{
+        { 0, 0 }, { util::EXTENT, 0 }, { 0, util::EXTENT }, { util::EXTENT, util::EXTENT }
+    }};
+
+    for (auto& corner : corners) {
+        const double w = tileMatrix[3] * corner.x + tileMatrix[7] * corner.y + tileMatrix[15];
+        if (w <= 0) {
+            return {};
+        }
+        corner = {
+            viewport.x + ((tileMatrix[0] * corner.x + tileMatrix[4] * corner.y + tileMatrix[12]) / w + 1) / 2 * viewport.size.width,
+            viewport.y + ((tileMatrix[1] * corner.x + tileMatrix[5] * corner.y + tileMatrix[13]) / w + 1) / 2 * viewport.size.height
+        };
+    }
+
+    const double epsilon = 0.01;
+    const bool aligned =
+        (std::abs(corners[0].y - corners[1].y) < epsilon && std::abs(corners[0].x - corners[2].x) < epsilon) ||
+        (std::abs(corners[0].x - corners[1].x) < epsilon && std::abs(corners[0].y - corners[2].y) < epsilon);
+    if (!aligned) {
+        return {};
+    }
+
+    // Round edges to the nearest pixel boundary. Like rasterizing the stencil mask, this assigns
+    // every pixel to exactly one of two adjacent tiles.
+    const auto pixelX = [&](double x) {
+        return static_cast<int32_t>(util::clamp<double>(std::round(x), viewport.x, viewport.x + viewport.size.width));
+    };
+    const auto pixelY = [&](double y) {
+        return static_cast<int32_t>(util::clamp<double>(std::round(y), viewport.y, viewport.y + viewport.size.height));
+    };
+    const int32_t x0 = pixelX(std::min(corners[0].x, corners[3].x));
+    const int32_t x1 = pixelX(std::max(corners[0].x, corners[3].x));
+    const int32_t y0 = pixelY(std::min(corners[0].y, corners[3].y));
+    const int32_t y1 = pixelY(std::max(corners[0].y, corners[3].y));
+
+    return gl::StencilMode::Scissor { x0, y0, { static_cast<uint32_t>(x1 - x0), static_cast<uint32_t>(y1 - y0) } };
+}
+
 void RenderTile::setMask(TileMask&& mask) {
     tile.setMask(std::move(mask));
 }
@@ -65,6 +150,10 @@ void RenderTile::startRender(PaintParameters& parameters) {
     parameters.state.matrixFor(nearClippedMatrix, id);
     matrix::multiply(matrix, parameters.projMatrix, matrix);
     matrix::multiply(nearClippedMatrix, parameters.nearClippedProjMatrix, nearClippedMatrix);
+
+    const gl::value::Viewport::Type viewport = parameters.context.viewport.getCurrentValue();
+    culled = isCulled(matrix, viewport.size);
+    scissor = scissorFor(matrix, viewport);
 }
 
 void RenderTile::finishRender(PaintParameters& parameters) {
@@ -89,7 +178,7 @@ void RenderTile::finishRender(PaintParameters& parameters) {
             parameters.context,
             gl::Lines { 4.0f * parameters.pixelRatio },
             gl::DepthMode::disabled(),
-            parameters.stencilModeForClipping(clip),
+            parameters.stencilModeForClipping(*this),
             gl::ColorMode::unblended(),
             DebugProgram::UniformValues {
                 uniforms::u_matrix::Value{ matrix },
@@ -101,14 +190,14 @@ void RenderTile::finishRender(PaintParameters& parameters) {
             paintAttibuteData,
             properties,
             parameters.state.getZoom(),
-            "debug"
+            debugVertexArrayIndex
         );
 
         parameters.programs.debug.draw(
             parameters.context,
             gl::Lines { 2.0f * parameters.pixelRatio },
             gl::DepthMode::disabled(),
-            parameters.stencilModeForClipping(clip),
+            parameters.stencilModeForClipping(*this),
             gl::ColorMode::unblended(),
             DebugProgram::UniformValues {
                 uniforms::u_matrix::Value{ matrix },
@@ -120,7 +209,7 @@ void RenderTile::finishRender(PaintParameters& parameters) {
             paintAttibuteData,
             properties,
             parameters.state.getZoom(),
-            "debug"
+            debugVertexArrayIndex
         );
     }
 
@@ -129,7 +218,7 @@ void RenderTile::finishRender(PaintParameters& parameters) {
             parameters.context,
             gl::LineStrip { 4.0f * parameters.pixelRatio },
             gl::DepthMode::disabled(),
-            parameters.stencilModeForClipping(clip),
+            parameters.stencilModeForClipping(*this),
             gl::ColorMode::unblended(),
             DebugProgram::UniformValues {
                 uniforms::u_matrix::Value{ matrix },
@@ -141,7 +230,7 @@ void RenderTile::finishRender(PaintParameters& parameters) {
             paintAttibuteData,
             properties,
             parameters.state.getZoom(),
-            "debug"
+            debugVertexArrayIndex
         );
     }
 }
@@ -5,6 +5,9 @@
 #include <mbgl/util/clip_id.hpp>
 #include <mbgl/style/types.hpp>
 #include <mbgl/renderer/tile_mask.hpp>
+#include <mbgl/gl/stencil_mode.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/size.hpp>
 
 #include <array>
 
@@ -29,6 +32,14 @@ public:
     mat4 nearClippedMatrix;
     bool used = false;
 
+    // Whether the tile is outside of the viewport or covers no pixel center, as of the last
+    // startRender(). Layers that are clipped to tile bounds skip culled tiles.
+    bool culled = false;
+
+    // The framebuffer rectangle covered by the tile, if it is an axis-aligned rectangle on screen,
+    // i.e. when the map is neither pitched nor rotated by other than a multiple of 90°.
+    optional<gl::StencilMode::Scissor> scissor;
+
     mat4 translatedMatrix(const std::array<float, 2>& translate,
                           style::TranslateAnchorType anchor,
                           const TransformState&) const;
@@ -37,6 +48,10 @@ public:
                               style::TranslateAnchorType anchor,
                               const TransformState&) const;
 
+    // Whether a tile projected with the given matrix generates no fragments in a framebuffer of the
+    // given size.
+    static bool isCulled(const mat4& matrix, const Size& framebufferSize);
+
     void setMask(TileMask&&);
     void startRender(PaintParameters&);
     void finishRender(PaintParameters&);
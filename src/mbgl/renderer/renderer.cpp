@@ -10,9 +10,11 @@ Renderer::Renderer(RendererBackend& backend,
                    FileSource& fileSource_,
                    Scheduler& scheduler_,
                    GLContextMode contextMode_,
-                   const optional<std::string> programCacheDir_)
+                   const optional<std::string> programCacheDir_,
+                   const optional<std::string> layoutCacheDir_)
         : impl(std::make_unique<Impl>(backend, pixelRatio_, fileSource_, scheduler_,
-                                      contextMode_, std::move(programCacheDir_))) {
+                                      contextMode_, std::move(programCacheDir_),
+                                      std::move(layoutCacheDir_))) {
 }
 
 Renderer::~Renderer() = default;
@@ -46,6 +48,28 @@ std::vector<Feature> Renderer::queryRenderedFeatures(const ScreenBox& box, const
     );
 }
 
+void Renderer::queryRenderedFeatures(const ScreenLineString& geometry, const RenderedQueryOptions& options, const RenderedFeatureCallback& callback) const {
+    impl->queryRenderedFeatures(geometry, options, callback);
+}
+
+void Renderer::queryRenderedFeatures(const ScreenCoordinate& point, const RenderedQueryOptions& options, const RenderedFeatureCallback& callback) const {
+    impl->queryRenderedFeatures({ point }, options, callback);
+}
+
+void Renderer::queryRenderedFeatures(const ScreenBox& box, const RenderedQueryOptions& options, const RenderedFeatureCallback& callback) const {
+    impl->queryRenderedFeatures(
+            {
+                    box.min,
+                    {box.max.x, box.min.y},
+                    box.max,
+                    {box.min.x, box.max.y},
+                    box.min
+            },
+            options,
+            callback
+    );
+}
+
 AnnotationIDs Renderer::queryPointAnnotations(const ScreenBox& box) const {
     RenderedQueryOptions options;
     options.layerIDs = {{ AnnotationManager::PointLayerID }};
@@ -71,6 +95,10 @@ void Renderer::dumpDebugLogs() {
     impl->dumDebugLogs();
 }
 
+FrameStats Renderer::getFrameStats() const {
+    return impl->frameStats;
+}
+
 void Renderer::onLowMemory() {
     impl->onLowMemory();
 }
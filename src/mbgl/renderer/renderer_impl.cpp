@@ -2,6 +2,7 @@
 #include <mbgl/renderer/render_style.hpp>
 #include <mbgl/renderer/render_static_data.hpp>
 #include <mbgl/renderer/render_item.hpp>
+#include <mbgl/renderer/render_tile.hpp>
 #include <mbgl/renderer/update_parameters.hpp>
 #include <mbgl/renderer/paint_parameters.hpp>
 #include <mbgl/renderer/backend_scope.hpp>
@@ -18,18 +19,22 @@ static RendererObserver& nullObserver() {
     return observer;
 }
 
+// CPU time per frame spent compiling programs for layers that haven't been drawn yet.
+static const Duration programPreparationBudget = Milliseconds(4);
+
 Renderer::Impl::Impl(RendererBackend& backend_,
                      float pixelRatio_,
                      FileSource& fileSource_,
                      Scheduler& scheduler_,
                      GLContextMode contextMode_,
-                     const optional<std::string> programCacheDir_)
+                     const optional<std::string> programCacheDir_,
+                     const optional<std::string> layoutCacheDir_)
         : backend(backend_)
         , observer(&nullObserver())
         , contextMode(contextMode_)
         , pixelRatio(pixelRatio_)
         , programCacheDir(programCacheDir_)
-        , renderStyle(std::make_unique<RenderStyle>(scheduler_, fileSource_)) {
+        , renderStyle(std::make_unique<RenderStyle>(scheduler_, fileSource_, layoutCacheDir_)) {
 
     renderStyle->setObserver(this);
 }
@@ -70,6 +75,8 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
 
     bool loaded = updateParameters.styleLoaded && renderStyle->isLoaded();
 
+    parameters.context.statistics = {};
+
     if (updateParameters.mode == MapMode::Continuous) {
         if (renderState == RenderState::Never) {
             observer->onWillStartRenderingMap();
@@ -80,7 +87,13 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
         backend.updateAssumedState();
 
         doRender(parameters);
+
+        // Compile programs that later frames will need, e.g. for tiles that are still loading,
+        // so that they don't stall the frame in which they're first drawn.
+        renderStyle->preparePrograms(parameters.programs, Clock::now() + programPreparationBudget);
+
         parameters.context.performCleanup();
+        collectFrameStats(parameters.context);
 
         observer->onDidFinishRenderingFrame(
                 loaded ? RendererObserver::RenderMode::Full : RendererObserver::RenderMode::Partial,
@@ -106,9 +119,20 @@ void Renderer::Impl::render(const UpdateParameters& updateParameters) {
 
         // Cleanup only after signaling completion
         parameters.context.performCleanup();
+        collectFrameStats(parameters.context);
     }
 }
 
+void Renderer::Impl::collectFrameStats(const gl::Context& context) {
+    frameStats.drawCalls = context.statistics.drawCalls;
+    frameStats.programBinds = context.statistics.programBinds;
+    frameStats.vertices = context.statistics.vertices;
+    frameStats.indices = context.statistics.indices;
+    frameStats.textureBytes = context.statistics.textureBytes;
+    frameStats.bufferBytes = context.statistics.bufferBytes;
+    frameStats.deletedObjects = context.statistics.deletedObjects;
+}
+
 void Renderer::Impl::doRender(PaintParameters& parameters) {
     if (parameters.contextMode == GLContextMode::Shared) {
         parameters.context.setDirtyState();
@@ -122,6 +146,12 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
                         parameters.state.getZoom(),
                         parameters.mapMode == MapMode::Continuous ? util::DEFAULT_TRANSITION_DURATION : Milliseconds(0));
 
+    frameStats.tiles.clear();
+    frameStats.culledTiles = 0;
+    frameStats.clippingMasks = 0;
+    frameStats.opaqueTime = frameStats.translucentTime = Duration::zero();
+    TimePoint passStart = Clock::now();
+
     // - UPLOAD PASS -------------------------------------------------------------------------------
     // Uploads all required buffers and images before we do any actual rendering.
     {
@@ -132,6 +162,8 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
         parameters.frameHistory.upload(parameters.context, 0);
     }
 
+    frameStats.uploadTime = Clock::now() - passStart;
+
     // - CLEAR -------------------------------------------------------------------------------------
     // Renders the backdrop of the OpenGL view. This also paints in areas where we don't have any
     // tiles whatsoever.
@@ -147,12 +179,35 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
 
     // - CLIPPING MASKS ----------------------------------------------------------------------------
     // Draws the clipping masks to the stencil buffer.
+    passStart = Clock::now();
     {
         MBGL_DEBUG_GROUP(parameters.context, "clip");
 
+        // Without overlapping tiles, and as long as tiles are axis-aligned rectangles on screen,
+        // clipping to tile bounds only requires scissor rectangles. Stencil masks are still used
+        // when the backend has the scissor test enabled itself, or when they are being debugged.
+        parameters.scissorClipping = !parameters.context.scissorTest.getCurrentValue();
+#if not MBGL_USE_GLES2
+        if (parameters.debugOptions & MapDebugOptions::StencilClip) {
+            parameters.scissorClipping = false;
+        }
+#endif
+
         // Update all clipping IDs.
         for (const auto& source : sources) {
             source->startRender(parameters);
+            const auto& renderTiles = source->getRenderTiles();
+            frameStats.tiles[source->baseImpl->id] = renderTiles.size();
+            for (const RenderTile& tile : renderTiles) {
+                frameStats.culledTiles += tile.culled;
+                if (!tile.scissor) {
+                    parameters.scissorClipping = false;
+                }
+            }
+        }
+
+        if (parameters.clipIDGenerator.hasOverlappingTiles()) {
+            parameters.scissorClipping = false;
         }
 
         MBGL_DEBUG_GROUP(parameters.context, "clipping masks");
@@ -160,7 +215,12 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
         static const style::FillPaintProperties::PossiblyEvaluated properties {};
         static const FillProgram::PaintPropertyBinders paintAttibuteData(properties, 0);
 
-        for (const auto& clipID : parameters.clipIDGenerator.getClipIDs()) {
+        const auto clipIDs = parameters.scissorClipping
+            ? std::map<UnwrappedTileID, ClipID>()
+            : parameters.clipIDGenerator.getClipIDs();
+        frameStats.clippingMasks = clipIDs.size();
+
+        for (const auto& clipID : clipIDs) {
             parameters.staticData.programs.fill.get(properties).draw(
                 parameters.context,
                 gl::Triangles(),
@@ -171,7 +231,8 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
                     0b11111111,
                     gl::StencilMode::Keep,
                     gl::StencilMode::Keep,
-                    gl::StencilMode::Replace
+                    gl::StencilMode::Replace,
+                    {}
                 },
                 gl::ColorMode::disabled(),
                 FillProgram::UniformValues {
@@ -184,11 +245,13 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
                 paintAttibuteData,
                 properties,
                 parameters.state.getZoom(),
-                "clipping"
+                clippingVertexArrayIndex
             );
         }
     }
 
+    frameStats.clipTime = Clock::now() - passStart;
+
 #if not MBGL_USE_GLES2 and not defined(NDEBUG)
     // Render tile clip boundaries, using stencil buffer to calculate fill color.
     if (parameters.debugOptions & MapDebugOptions::StencilClip) {
@@ -229,6 +292,7 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
 
     // - OPAQUE PASS -------------------------------------------------------------------------------
     // Render everything top-to-bottom by using reverse iterators. Render opaque objects first.
+    passStart = Clock::now();
     {
         parameters.pass = RenderPass::Opaque;
         MBGL_DEBUG_GROUP(parameters.context, "opaque");
@@ -251,8 +315,11 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
         }
     }
 
+    frameStats.opaqueTime = Clock::now() - passStart;
+
     // - TRANSLUCENT PASS --------------------------------------------------------------------------
     // Make a second pass, rendering translucent objects. This time, we render bottom-to-top.
+    passStart = Clock::now();
     {
         parameters.pass = RenderPass::Translucent;
         MBGL_DEBUG_GROUP(parameters.context, "translucent");
@@ -275,6 +342,8 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
         }
     }
 
+    frameStats.translucentTime = Clock::now() - passStart;
+
     if (debug::renderTree) { Log::Info(Event::Render, "}"); indent--; }
 
     // - DEBUG PASS --------------------------------------------------------------------------------
@@ -319,6 +388,9 @@ void Renderer::Impl::doRender(PaintParameters& parameters) {
     {
         MBGL_DEBUG_GROUP(parameters.context, "cleanup");
 
+        // Turns off the scissor test in case the last draw call clipped with it.
+        parameters.context.setStencilMode(gl::StencilMode::disabled());
+
         parameters.context.activeTexture = 1;
         parameters.context.texture[1] = 0;
         parameters.context.activeTexture = 0;
@@ -332,6 +404,10 @@ std::vector<Feature> Renderer::Impl::queryRenderedFeatures(const ScreenLineStrin
     return renderStyle->queryRenderedFeatures(geometry, transformState, options);
 }
 
+void Renderer::Impl::queryRenderedFeatures(const ScreenLineString& geometry, const RenderedQueryOptions& options, const RenderedFeatureCallback& callback) const {
+    renderStyle->queryRenderedFeatures(geometry, transformState, options, callback);
+}
+
 std::vector<Feature> Renderer::Impl::querySourceFeatures(const std::string& sourceID, const SourceQueryOptions& options) const {
     const RenderSource* source = renderStyle->getRenderSource(sourceID);
     if (!source) return {};
@@ -21,7 +21,8 @@ class RenderStaticData;
 class Renderer::Impl : public RenderStyleObserver {
 public:
     Impl(RendererBackend&, float pixelRatio_, FileSource&, Scheduler&, GLContextMode,
-         const optional<std::string> programCacheDir);
+         const optional<std::string> programCacheDir,
+         const optional<std::string> layoutCacheDir);
     ~Impl() final;
 
     void setObserver(RendererObserver*);
@@ -29,6 +30,7 @@ public:
     void render(const UpdateParameters&);
 
     std::vector<Feature> queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions&) const;
+    void queryRenderedFeatures(const ScreenLineString&, const RenderedQueryOptions&, const RenderedFeatureCallback&) const;
     std::vector<Feature> querySourceFeatures(const std::string& sourceID, const SourceQueryOptions&) const;
 
     void onLowMemory();
@@ -40,6 +42,7 @@ public:
 
 private:
     void doRender(PaintParameters&);
+    void collectFrameStats(const gl::Context&);
 
     friend class Renderer;
 
@@ -58,6 +61,7 @@ private:
 
     RenderState renderState = RenderState::Never;
     FrameHistory frameHistory;
+    FrameStats frameStats;
     TransformState transformState;
 
     std::unique_ptr<RenderStyle> renderStyle;
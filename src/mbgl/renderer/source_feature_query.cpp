@@ -0,0 +1,82 @@
+#include <mbgl/renderer/source_feature_query.hpp>
+#include <mbgl/style/filter_evaluator.hpp>
+#include <mbgl/tile/tile_id.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/tile_coordinate.hpp>
+
+#include <mapbox/geometry/envelope.hpp>
+
+namespace mbgl {
+
+SourceFeatureQuery::SourceFeatureQuery(const SourceQueryOptions& options_)
+    : options(options_) {
+}
+
+bool SourceFeatureQuery::isComplete() const {
+    return options.limit && result.size() >= *options.limit;
+}
+
+void SourceFeatureQuery::addLayer(const GeometryTileLayer& layer,
+                                  const std::string& sourceLayer,
+                                  const OverscaledTileID& tileID) {
+    optional<mapbox::geometry::box<int16_t>> box;
+
+    if (options.bounds) {
+        const UnwrappedTileID unwrapped { 0, tileID.canonical };
+        box = mapbox::geometry::box<int16_t> {
+            TileCoordinate::toGeometryCoordinate(unwrapped, TileCoordinate::fromLatLng(0, options.bounds->northwest()).p),
+            TileCoordinate::toGeometryCoordinate(unwrapped, TileCoordinate::fromLatLng(0, options.bounds->southeast()).p)
+        };
+
+        // Skip tiles that are entirely outside of the bounds.
+        if (box->max.x < 0 || box->max.y < 0 || box->min.x > util::EXTENT || box->min.y > util::EXTENT) {
+            return;
+        }
+    }
+
+    const std::size_t featureCount = layer.featureCount();
+    for (std::size_t i = 0; i < featureCount && !isComplete(); i++) {
+        auto feature = layer.getFeature(i);
+
+        // Skip features already found in another tile.
+        auto id = feature->getID();
+        if (id) {
+            auto it = ids.find({ sourceLayer, *id });
+            if (it != ids.end() && it->second != tileID) {
+                continue;
+            }
+        }
+
+        // Apply filter, if any
+        if (options.filter && !(*options.filter)(*feature)) {
+            continue;
+        }
+
+        // Apply bounds, if any, to the feature's bounding box within this tile.
+        if (box) {
+            bool intersects = false;
+            for (const auto& ring : feature->getGeometries()) {
+                if (ring.empty()) {
+                    continue;
+                }
+                const auto envelope = mapbox::geometry::envelope(ring);
+                if (envelope.min.x <= box->max.x && envelope.max.x >= box->min.x &&
+                    envelope.min.y <= box->max.y && envelope.max.y >= box->min.y) {
+                    intersects = true;
+                    break;
+                }
+            }
+            if (!intersects) {
+                continue;
+            }
+        }
+
+        if (id) {
+            ids.emplace(std::make_pair(sourceLayer, std::move(*id)), tileID);
+        }
+
+        result.push_back(convertFeature(*feature, tileID.canonical));
+    }
+}
+
+} // namespace mbgl
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <mbgl/renderer/query.hpp>
+#include <mbgl/tile/geometry_tile_data.hpp>
+#include <mbgl/tile/tile_id.hpp>
+#include <mbgl/util/feature.hpp>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mbgl {
+
+// Collects the results of a source feature query across the tiles of a source. Features that are
+// split across tiles are returned once, for the first tile they're found in. Features of the same
+// tile that share an ID are all returned. Collection stops at the query's limit.
+class SourceFeatureQuery {
+public:
+    SourceFeatureQuery(const SourceQueryOptions&);
+
+    // Adds the features of a tile's source layer that match the query options.
+    void addLayer(const GeometryTileLayer&, const std::string& sourceLayer, const OverscaledTileID&);
+
+    // Whether the limit has been reached.
+    bool isComplete() const;
+
+    const SourceQueryOptions& options;
+    std::vector<Feature> result;
+
+private:
+    // Source layer and ID of the features already in the result, and the tile they were found in.
+    std::map<std::pair<std::string, FeatureIdentifier>, OverscaledTileID> ids;
+};
+
+} // namespace mbgl
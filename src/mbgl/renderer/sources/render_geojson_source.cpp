@@ -68,10 +68,14 @@ void RenderGeoJSONSource::finishRender(PaintParameters& parameters) {
     tilePyramid.finishRender(parameters);
 }
 
-std::vector<std::reference_wrapper<RenderTile>> RenderGeoJSONSource::getRenderTiles() {
+const std::vector<std::reference_wrapper<RenderTile>>& RenderGeoJSONSource::getRenderTiles() {
     return tilePyramid.getRenderTiles();
 }
 
+const std::vector<std::reference_wrapper<RenderTile>>& RenderGeoJSONSource::getSymbolSortedRenderTiles(float angle) {
+    return tilePyramid.getSymbolSortedRenderTiles(angle);
+}
+
 std::unordered_map<std::string, std::vector<Feature>>
 RenderGeoJSONSource::queryRenderedFeatures(const ScreenLineString& geometry,
                                            const TransformState& transformState,
@@ -80,6 +84,14 @@ RenderGeoJSONSource::queryRenderedFeatures(const ScreenLineString& geometry,
     return tilePyramid.queryRenderedFeatures(geometry, transformState, style, options);
 }
 
+bool RenderGeoJSONSource::queryRenderedFeatures(const ScreenLineString& geometry,
+                                                const TransformState& transformState,
+                                                const RenderStyle& style,
+                                                const RenderedQueryOptions& options,
+                                                const RenderedFeatureCallback& callback) const {
+    return tilePyramid.queryRenderedFeatures(geometry, transformState, style, options, callback);
+}
+
 std::vector<Feature> RenderGeoJSONSource::querySourceFeatures(const SourceQueryOptions& options) const {
     return tilePyramid.querySourceFeatures(options);
 }
@@ -75,7 +75,7 @@ void RenderImageSource::finishRender(PaintParameters& parameters) {
             paintAttibuteData,
             properties,
             parameters.state.getZoom(),
-            "debug"
+            debugVertexArrayIndex
         );
     }
 }
@@ -88,6 +88,14 @@ RenderImageSource::queryRenderedFeatures(const ScreenLineString&,
     return std::unordered_map<std::string, std::vector<Feature>> {};
 }
 
+bool RenderImageSource::queryRenderedFeatures(const ScreenLineString&,
+                                              const TransformState&,
+                                              const RenderStyle&,
+                                              const RenderedQueryOptions&,
+                                              const RenderedFeatureCallback&) const {
+    return true;
+}
+
 std::vector<Feature> RenderImageSource::querySourceFeatures(const SourceQueryOptions&) const {
     return {};
 }
@@ -24,8 +24,12 @@ public:
                 bool needsRelayout,
                 const TileParameters&) final;
 
-    std::vector<std::reference_wrapper<RenderTile>> getRenderTiles() final {
-        return {};
+    const std::vector<std::reference_wrapper<RenderTile>>& getRenderTiles() final {
+        return renderTiles;
+    }
+
+    const std::vector<std::reference_wrapper<RenderTile>>& getSymbolSortedRenderTiles(float) final {
+        return renderTiles;
     }
 
     std::unordered_map<std::string, std::vector<Feature>>
@@ -34,6 +38,12 @@ public:
                           const RenderStyle& style,
                           const RenderedQueryOptions& options) const final;
 
+    bool queryRenderedFeatures(const ScreenLineString& geometry,
+                               const TransformState& transformState,
+                               const RenderStyle& style,
+                               const RenderedQueryOptions& options,
+                               const RenderedFeatureCallback& callback) const final;
+
     std::vector<Feature> querySourceFeatures(const SourceQueryOptions&) const final;
 
     void onLowMemory() final {
@@ -48,6 +58,9 @@ private:
     std::vector<UnwrappedTileID> tileIds;
     std::unique_ptr<RasterBucket> bucket;
     std::vector<mat4> matrices;
+
+    // Image sources are drawn without render tiles.
+    const std::vector<std::reference_wrapper<RenderTile>> renderTiles;
 };
 
 template <>
@@ -53,7 +53,7 @@ void RenderRasterSource::update(Immutable<style::Source::Impl> baseImpl_,
                        impl().getTileSize(),
                        tileset->zoomRange,
                        [&] (const OverscaledTileID& tileID) {
-                           return std::make_unique<RasterTile>(tileID, parameters, *tileset);
+                           return std::make_unique<RasterTile>(tileID, parameters, *tileset, impl().getTileSize());
                        });
 }
 
@@ -66,10 +66,14 @@ void RenderRasterSource::finishRender(PaintParameters& parameters) {
     tilePyramid.finishRender(parameters);
 }
 
-std::vector<std::reference_wrapper<RenderTile>> RenderRasterSource::getRenderTiles() {
+const std::vector<std::reference_wrapper<RenderTile>>& RenderRasterSource::getRenderTiles() {
     return tilePyramid.getRenderTiles();
 }
 
+const std::vector<std::reference_wrapper<RenderTile>>& RenderRasterSource::getSymbolSortedRenderTiles(float angle) {
+    return tilePyramid.getSymbolSortedRenderTiles(angle);
+}
+
 std::unordered_map<std::string, std::vector<Feature>>
 RenderRasterSource::queryRenderedFeatures(const ScreenLineString&,
                                           const TransformState&,
@@ -78,6 +82,14 @@ RenderRasterSource::queryRenderedFeatures(const ScreenLineString&,
     return std::unordered_map<std::string, std::vector<Feature>> {};
 }
 
+bool RenderRasterSource::queryRenderedFeatures(const ScreenLineString&,
+                                               const TransformState&,
+                                               const RenderStyle&,
+                                               const RenderedQueryOptions&,
+                                               const RenderedFeatureCallback&) const {
+    return true;
+}
+
 std::vector<Feature> RenderRasterSource::querySourceFeatures(const SourceQueryOptions&) const {
     return {};
 }
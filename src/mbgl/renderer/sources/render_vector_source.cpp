@@ -69,10 +69,14 @@ void RenderVectorSource::finishRender(PaintParameters& parameters) {
     tilePyramid.finishRender(parameters);
 }
 
-std::vector<std::reference_wrapper<RenderTile>> RenderVectorSource::getRenderTiles() {
+const std::vector<std::reference_wrapper<RenderTile>>& RenderVectorSource::getRenderTiles() {
     return tilePyramid.getRenderTiles();
 }
 
+const std::vector<std::reference_wrapper<RenderTile>>& RenderVectorSource::getSymbolSortedRenderTiles(float angle) {
+    return tilePyramid.getSymbolSortedRenderTiles(angle);
+}
+
 std::unordered_map<std::string, std::vector<Feature>>
 RenderVectorSource::queryRenderedFeatures(const ScreenLineString& geometry,
                                           const TransformState& transformState,
@@ -81,6 +85,14 @@ RenderVectorSource::queryRenderedFeatures(const ScreenLineString& geometry,
     return tilePyramid.queryRenderedFeatures(geometry, transformState, style, options);
 }
 
+bool RenderVectorSource::queryRenderedFeatures(const ScreenLineString& geometry,
+                                               const TransformState& transformState,
+                                               const RenderStyle& style,
+                                               const RenderedQueryOptions& options,
+                                               const RenderedFeatureCallback& callback) const {
+    return tilePyramid.queryRenderedFeatures(geometry, transformState, style, options, callback);
+}
+
 std::vector<Feature> RenderVectorSource::querySourceFeatures(const SourceQueryOptions& options) const {
     return tilePyramid.querySourceFeatures(options);
 }
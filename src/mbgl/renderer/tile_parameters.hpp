@@ -2,6 +2,8 @@
 
 #include <mbgl/map/mode.hpp>
 
+#include <memory>
+
 namespace mbgl {
 
 class TransformState;
@@ -10,6 +12,7 @@ class FileSource;
 class AnnotationManager;
 class ImageManager;
 class GlyphManager;
+class LayoutCache;
 
 class TileParameters {
 public:
@@ -23,6 +26,7 @@ public:
     ImageManager& imageManager;
     GlyphManager& glyphManager;
     const uint8_t prefetchZoomDelta;
+    const std::shared_ptr<LayoutCache> layoutCache;
 };
 
 } // namespace mbgl
@@ -4,18 +4,26 @@
 #include <mbgl/renderer/render_source.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
 #include <mbgl/renderer/query.hpp>
+#include <mbgl/renderer/render_style.hpp>
+#include <mbgl/renderer/source_feature_query.hpp>
 #include <mbgl/map/transform.hpp>
 #include <mbgl/text/placement_config.hpp>
 #include <mbgl/math/clamp.hpp>
 #include <mbgl/util/tile_cover.hpp>
+#include <mbgl/util/tile_coordinate.hpp>
 #include <mbgl/util/enum.hpp>
 #include <mbgl/util/logging.hpp>
+#include <mbgl/util/math.hpp>
+#include <mbgl/util/parallel.hpp>
 
 #include <mbgl/algorithm/update_renderables.hpp>
 
 #include <mapbox/geometry/envelope.hpp>
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <tuple>
 
 namespace mbgl {
 
@@ -51,8 +59,43 @@ void TilePyramid::finishRender(PaintParameters& parameters) {
     }
 }
 
-std::vector<std::reference_wrapper<RenderTile>> TilePyramid::getRenderTiles() {
-    return { renderTiles.begin(), renderTiles.end() };
+const std::vector<std::reference_wrapper<RenderTile>>& TilePyramid::getRenderTiles() const {
+    return sortedRenderTiles;
+}
+
+const std::vector<std::reference_wrapper<RenderTile>>& TilePyramid::getSymbolSortedRenderTiles(float angle) {
+    if (symbolSortAngle && *symbolSortAngle == angle) {
+        return symbolSortedRenderTiles;
+    }
+
+    // Sort symbol tiles in opposite y position, so tiles with overlapping symbols are drawn
+    // on top of each other, with lower symbols being drawn on top of higher symbols.
+    symbolSortedRenderTiles = sortedRenderTiles;
+    std::sort(symbolSortedRenderTiles.begin(), symbolSortedRenderTiles.end(),
+              [angle](const RenderTile& a, const RenderTile& b) {
+        Point<float> pa(a.id.canonical.x, a.id.canonical.y);
+        Point<float> pb(b.id.canonical.x, b.id.canonical.y);
+
+        auto par = util::rotate(pa, angle);
+        auto pbr = util::rotate(pb, angle);
+
+        return std::tie(par.y, par.x) < std::tie(pbr.y, pbr.x);
+    });
+    symbolSortAngle = angle;
+
+    return symbolSortedRenderTiles;
+}
+
+// Tiles closer to the center of the map are requested first. The distance is measured in quarter
+// tiles at the current zoom level, so that panning doesn't reorder the request queue every frame.
+// Requests for required tiles are made before those for optional tiles regardless of priority.
+static int32_t tilePriority(const TileCoordinate& center, const UnwrappedTileID& id) {
+    const double scale = std::pow(2.0, center.z - id.canonical.z);
+    const double worldSize = std::pow(2.0, id.canonical.z);
+    const double dx = (id.canonical.x + id.wrap * worldSize + 0.5) * scale - center.p.x;
+    const double dy = (id.canonical.y + 0.5) * scale - center.p.y;
+    const double distance = std::floor(std::sqrt(dx * dx + dy * dy) * 4);
+    return -int32_t(std::min<double>(distance, std::numeric_limits<int32_t>::max()));
 }
 
 void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layers,
@@ -79,6 +122,9 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
 
         tiles.clear();
         renderTiles.clear();
+        sortedRenderTiles.clear();
+        symbolSortedRenderTiles.clear();
+        symbolSortAngle = {};
 
         return;
     }
@@ -112,7 +158,14 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
             }
         }
 
-        idealTiles = util::tileCover(parameters.transformState, idealZoom);
+        // In pitched views, tiles of vector data far from the camera are replaced by tiles of lower
+        // zoom levels. Raster tiles would visibly lose detail, and annotation tiles are cheap to
+        // generate, so they're always covered at the ideal zoom level.
+        if (type == SourceType::Vector || type == SourceType::GeoJSON) {
+            idealTiles = util::tileCoverWithLOD(parameters.transformState, idealZoom, zoomRange.min);
+        } else {
+            idealTiles = util::tileCover(parameters.transformState, idealZoom);
+        }
     }
 
     // Stores a list of all the tiles that we're definitely going to retain. There are two
@@ -162,6 +215,12 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
     algorithm::updateRenderables(getTileFn, createTileFn, retainTileFn, renderTileFn,
                                  idealTiles, zoomRange, tileZoom);
 
+    sortedRenderTiles = { renderTiles.begin(), renderTiles.end() };
+    std::sort(sortedRenderTiles.begin(), sortedRenderTiles.end(),
+              [](const RenderTile& a, const RenderTile& b) { return a.id < b.id; });
+    symbolSortedRenderTiles.clear();
+    symbolSortAngle = {};
+
     if (type != SourceType::Annotations) {
         size_t conservativeCacheSize =
             std::max((float)parameters.transformState.getSize().width / tileSize, 1.0f) *
@@ -173,7 +232,12 @@ void TilePyramid::update(const std::vector<Immutable<style::Layer::Impl>>& layer
 
     removeStaleTiles(retain);
 
+    const TileCoordinate center = TileCoordinate::fromLatLng(parameters.transformState.getZoom(),
+                                                             parameters.transformState.getLatLng());
+
     for (auto& pair : tiles) {
+        pair.second->setPriority(tilePriority(center, pair.first.toUnwrapped()));
+
         const PlacementConfig config { parameters.transformState.getAngle(),
                                        parameters.transformState.getPitch(),
                                        parameters.transformState.getCameraToCenterDistance(),
@@ -204,11 +268,13 @@ void TilePyramid::removeStaleTiles(const std::set<OverscaledTileID>& retain) {
     }
 }
 
-std::unordered_map<std::string, std::vector<Feature>> TilePyramid::queryRenderedFeatures(const ScreenLineString& geometry,
-                                           const TransformState& transformState,
-                                           const RenderStyle& style,
-                                           const RenderedQueryOptions& options) const {
-    std::unordered_map<std::string, std::vector<Feature>> result;
+// Returns the render tiles intersecting the query geometry in the order they're queried in, along
+// with the query geometry in each tile's coordinate space.
+static std::vector<std::pair<std::reference_wrapper<const RenderTile>, GeometryCoordinates>>
+queriedTiles(const std::vector<RenderTile>& renderTiles,
+             const ScreenLineString& geometry,
+             const TransformState& transformState) {
+    std::vector<std::pair<std::reference_wrapper<const RenderTile>, GeometryCoordinates>> result;
     if (renderTiles.empty() || geometry.empty()) {
         return result;
     }
@@ -246,24 +312,70 @@ std::unordered_map<std::string, std::vector<Feature>> TilePyramid::queryRendered
             tileSpaceQueryGeometry.push_back(TileCoordinate::toGeometryCoordinate(renderTile.id, c));
         }
 
-        renderTile.tile.queryRenderedFeatures(result,
-                                              tileSpaceQueryGeometry,
-                                              transformState,
-                                              style,
-                                              options);
+        result.emplace_back(renderTile, std::move(tileSpaceQueryGeometry));
+    }
+
+    return result;
+}
+
+std::unordered_map<std::string, std::vector<Feature>> TilePyramid::queryRenderedFeatures(const ScreenLineString& geometry,
+                                           const TransformState& transformState,
+                                           const RenderStyle& style,
+                                           const RenderedQueryOptions& options) const {
+    std::unordered_map<std::string, std::vector<Feature>> result;
+
+    const auto tiles = queriedTiles(renderTiles, geometry, transformState);
+
+    // Tiles are queried in parallel, each into its own result, which are then merged in tile order.
+    std::vector<std::unordered_map<std::string, std::vector<Feature>>> tileResults(tiles.size());
+
+    util::parallelFor(style.scheduler, tiles.size(), [&] (std::size_t i) {
+        auto& tileResult = tileResults[i];
+        tiles[i].first.get().tile.queryRenderedFeatures([&] (const std::string& layerID, Feature&& feature) {
+            tileResult[layerID].push_back(std::move(feature));
+            return true;
+        }, tiles[i].second, transformState, style, options);
+    });
+
+    for (auto& tileResult : tileResults) {
+        for (auto& entry : tileResult) {
+            auto& layerResult = result[entry.first];
+            if (layerResult.empty()) {
+                layerResult = std::move(entry.second);
+            } else {
+                std::move(entry.second.begin(), entry.second.end(), std::back_inserter(layerResult));
+            }
+        }
     }
 
     return result;
 }
 
+bool TilePyramid::queryRenderedFeatures(const ScreenLineString& geometry,
+                                        const TransformState& transformState,
+                                        const RenderStyle& style,
+                                        const RenderedQueryOptions& options,
+                                        const RenderedFeatureCallback& callback) const {
+    for (const auto& tile : queriedTiles(renderTiles, geometry, transformState)) {
+        if (!tile.first.get().tile.queryRenderedFeatures(callback, tile.second, transformState, style, options)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 std::vector<Feature> TilePyramid::querySourceFeatures(const SourceQueryOptions& options) const {
-    std::vector<Feature> result;
+    SourceFeatureQuery query(options);
 
     for (const auto& pair : tiles) {
-        pair.second->querySourceFeatures(result, options);
+        if (query.isComplete()) {
+            break;
+        }
+        pair.second->querySourceFeatures(query);
     }
 
-    return result;
+    return std::move(query.result);
 }
 
 void TilePyramid::setCacheSize(size_t size) {
@@ -10,6 +10,7 @@
 #include <mbgl/util/mat4.hpp>
 #include <mbgl/util/feature.hpp>
 #include <mbgl/util/range.hpp>
+#include <mbgl/util/optional.hpp>
 
 #include <memory>
 #include <unordered_map>
@@ -22,8 +23,6 @@ class PaintParameters;
 class TransformState;
 class RenderTile;
 class RenderStyle;
-class RenderedQueryOptions;
-class SourceQueryOptions;
 class TileParameters;
 
 class TilePyramid {
@@ -45,7 +44,13 @@ public:
     void startRender(PaintParameters&);
     void finishRender(PaintParameters&);
 
-    std::vector<std::reference_wrapper<RenderTile>> getRenderTiles();
+    // Render tiles sorted by tile ID. The order is computed once per update(), and shared by all
+    // layers of the source.
+    const std::vector<std::reference_wrapper<RenderTile>>& getRenderTiles() const;
+
+    // Render tiles in the order symbol layers draw them at the given bearing. The order is kept
+    // until the render tiles or the bearing change.
+    const std::vector<std::reference_wrapper<RenderTile>>& getSymbolSortedRenderTiles(float angle);
 
     std::unordered_map<std::string, std::vector<Feature>>
     queryRenderedFeatures(const ScreenLineString& geometry,
@@ -53,6 +58,14 @@ public:
                           const RenderStyle& style,
                           const RenderedQueryOptions& options) const;
 
+    // Streams the features to the callback tile by tile, on the calling thread. Returns false if
+    // the callback stopped the query.
+    bool queryRenderedFeatures(const ScreenLineString& geometry,
+                               const TransformState& transformState,
+                               const RenderStyle& style,
+                               const RenderedQueryOptions& options,
+                               const RenderedFeatureCallback& callback) const;
+
     std::vector<Feature> querySourceFeatures(const SourceQueryOptions&) const;
 
     void setCacheSize(size_t);
@@ -69,6 +82,9 @@ public:
     TileCache cache;
 
     std::vector<RenderTile> renderTiles;
+    std::vector<std::reference_wrapper<RenderTile>> sortedRenderTiles;
+    std::vector<std::reference_wrapper<RenderTile>> symbolSortedRenderTiles;
+    optional<float> symbolSortAngle;
 
     TileObserver* observer = nullptr;
 };
@@ -17,13 +17,17 @@ public:
     ~FileSourceRequest() final;
 
     void onCancel(std::function<void()>&& callback);
+    void onPriorityChange(std::function<void(int32_t)>&& callback);
     void setResponse(const Response& res);
 
+    void setPriority(int32_t) final;
+
     ActorRef<FileSourceRequest> actor();
 
 private:
     FileSource::Callback responseCallback = nullptr;
     std::function<void()> cancelCallback = nullptr;
+    std::function<void(int32_t)> priorityCallback = nullptr;
 
     std::shared_ptr<Mailbox> mailbox;
 };
@@ -13,6 +13,16 @@ public:
 
     static uint32_t maximumConcurrentRequests();
 
+    // Number of requests to the origin of the given URL that may be in flight at the same
+    // time, if responses from that origin are known to share a connection (e.g. through
+    // HTTP/2 multiplexing). Returns 0 otherwise, in which case requests to the origin share
+    // the maximumConcurrentRequests() slots with requests to all other such origins.
+    uint32_t multiplexedRequestLimit(const std::string& url) const;
+
+    // Limits the number of connections that are opened to a single host. A value
+    // of 0 restores the platform default.
+    void setMaximumConnectionsPerHost(uint32_t);
+
     class Impl;
 
 private:
@@ -1,6 +1,9 @@
 #include <mbgl/style/layer.hpp>
 #include <mbgl/style/layer_impl.hpp>
 #include <mbgl/style/layer_observer.hpp>
+#include <mbgl/style/conversion/json.hpp>
+#include <mbgl/style/conversion/layer.hpp>
+#include <mbgl/util/logging.hpp>
 
 namespace mbgl {
 namespace style {
@@ -23,6 +26,7 @@ std::string Layer::getID() const {
 }
 
 VisibilityType Layer::getVisibility() const {
+    convertDeferredOnAccess();
     return baseImpl->visibility;
 }
 
@@ -38,5 +42,33 @@ void Layer::setObserver(LayerObserver* observer_) {
     observer = observer_ ? observer_ : &nullObserver;
 }
 
+bool Layer::convertDeferred() const {
+    if (!deferredJSON) {
+        return true;
+    }
+
+    const std::unique_ptr<const std::string> json = std::move(deferredJSON);
+
+    conversion::Error error;
+    optional<std::unique_ptr<Layer>> converted = conversion::convertJSON<std::unique_ptr<Layer>>(*json, error);
+    if (!converted) {
+        Log::Warning(Event::ParseStyle, error.message);
+        return false;
+    }
+
+    assert((*converted)->getType() == getType());
+
+    // Conversion only fills in what the placeholder was missing, so the layer is logically
+    // unchanged, and pointers to it remain valid.
+    const_cast<Layer&>(*this).baseImpl = (*converted)->baseImpl;
+    return true;
+}
+
+void Layer::convertDeferredOnAccess() const {
+    if (deferredJSON && convertDeferred()) {
+        observer->onLayerChanged(const_cast<Layer&>(*this));
+    }
+}
+
 } // namespace style
 } // namespace mbgl
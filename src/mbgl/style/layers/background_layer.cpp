@@ -18,6 +18,7 @@ BackgroundLayer::BackgroundLayer(Immutable<Impl> impl_)
 BackgroundLayer::~BackgroundLayer() = default;
 
 const BackgroundLayer::Impl& BackgroundLayer::impl() const {
+    convertDeferredOnAccess();
     return static_cast<const Impl&>(*baseImpl);
 }
 
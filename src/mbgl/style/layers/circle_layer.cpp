@@ -18,6 +18,7 @@ CircleLayer::CircleLayer(Immutable<Impl> impl_)
 CircleLayer::~CircleLayer() = default;
 
 const CircleLayer::Impl& CircleLayer::impl() const {
+    convertDeferredOnAccess();
     return static_cast<const Impl&>(*baseImpl);
 }
 
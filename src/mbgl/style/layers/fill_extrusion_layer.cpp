@@ -18,6 +18,7 @@ FillExtrusionLayer::FillExtrusionLayer(Immutable<Impl> impl_)
 FillExtrusionLayer::~FillExtrusionLayer() = default;
 
 const FillExtrusionLayer::Impl& FillExtrusionLayer::impl() const {
+    convertDeferredOnAccess();
     return static_cast<const Impl&>(*baseImpl);
 }
 
@@ -18,6 +18,7 @@ FillLayer::FillLayer(Immutable<Impl> impl_)
 FillLayer::~FillLayer() = default;
 
 const FillLayer::Impl& FillLayer::impl() const {
+    convertDeferredOnAccess();
     return static_cast<const Impl&>(*baseImpl);
 }
 
@@ -18,6 +18,7 @@ LineLayer::LineLayer(Immutable<Impl> impl_)
 LineLayer::~LineLayer() = default;
 
 const LineLayer::Impl& LineLayer::impl() const {
+    convertDeferredOnAccess();
     return static_cast<const Impl&>(*baseImpl);
 }
 
@@ -18,6 +18,7 @@ RasterLayer::RasterLayer(Immutable<Impl> impl_)
 RasterLayer::~RasterLayer() = default;
 
 const RasterLayer::Impl& RasterLayer::impl() const {
+    convertDeferredOnAccess();
     return static_cast<const Impl&>(*baseImpl);
 }
 
@@ -18,6 +18,7 @@ SymbolLayer::SymbolLayer(Immutable<Impl> impl_)
 SymbolLayer::~SymbolLayer() = default;
 
 const SymbolLayer::Impl& SymbolLayer::impl() const {
+    convertDeferredOnAccess();
     return static_cast<const Impl&>(*baseImpl);
 }
 
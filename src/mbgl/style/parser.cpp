@@ -14,6 +14,8 @@
 
 #include <rapidjson/document.h>
 #include <rapidjson/error/en.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 
 #include <algorithm>
 #include <set>
@@ -25,8 +27,12 @@ namespace style {
 Parser::~Parser() = default;
 
 StyleParseResult Parser::parse(const std::string& json) {
+    // Parse in place, so that strings point into this buffer instead of being allocated one by one.
+    std::vector<char> buffer(json.begin(), json.end());
+    buffer.push_back('\0');
+
     rapidjson::GenericDocument<rapidjson::UTF8<>, rapidjson::CrtAllocator> document;
-    document.Parse<0>(json.c_str());
+    document.ParseInsitu<0>(buffer.data());
 
     if (document.HasParseError()) {
         std::stringstream message;
@@ -197,6 +203,11 @@ void Parser::parseLayers(const JSValue& value) {
 
         layersMap.emplace(layerID, std::pair<const JSValue&, std::unique_ptr<Layer>> { layerValue, nullptr });
         ids.push_back(layerID);
+
+        if (layerValue.HasMember("ref") && layerValue["ref"].IsString()) {
+            const JSValue& ref = layerValue["ref"];
+            referencedLayers.emplace(ref.GetString(), ref.GetStringLength());
+        }
     }
 
     for (const auto& id : ids) {
@@ -257,6 +268,9 @@ void Parser::parseLayer(const std::string& id, const JSValue& value, std::unique
 
         layer = reference->cloneRef(id);
         conversion::setPaintProperties(*layer, value);
+    } else if (deferLayers && (value.HasMember("minzoom") || value.HasMember("maxzoom")) &&
+               referencedLayers.find(id) == referencedLayers.end()) {
+        parseDeferredLayer(id, value, layer);
     } else {
         conversion::Error error;
         optional<std::unique_ptr<Layer>> converted = conversion::convert<std::unique_ptr<Layer>>(value, error);
@@ -268,6 +282,33 @@ void Parser::parseLayer(const std::string& id, const JSValue& value, std::unique
     }
 }
 
+void Parser::parseDeferredLayer(const std::string& id, const JSValue& value, std::unique_ptr<Layer>& layer) {
+    // Convert only what's needed to place the layer in the style, skipping filter and properties.
+    rapidjson::CrtAllocator allocator;
+    JSValue header(rapidjson::kObjectType);
+    for (const char* member : { "id", "type", "source", "source-layer", "minzoom", "maxzoom" }) {
+        if (value.HasMember(member)) {
+            JSValue copy(value[member], allocator);
+            header.AddMember(rapidjson::StringRef(member), copy, allocator);
+        }
+    }
+
+    conversion::Error error;
+    optional<std::unique_ptr<Layer>> converted = conversion::convert<std::unique_ptr<Layer>>(header, error);
+    if (!converted) {
+        Log::Warning(Event::ParseStyle, error.message);
+        return;
+    }
+
+    layer = std::move(*converted);
+    layer->setVisibility(VisibilityType::None);
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    value.Accept(writer);
+    layer->deferredJSON = std::make_unique<const std::string>(buffer.GetString(), buffer.GetSize());
+}
+
 std::vector<FontStack> Parser::fontStacks() const {
     std::set<FontStack> optional;
 
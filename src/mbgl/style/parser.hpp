@@ -13,6 +13,7 @@
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <forward_list>
 
 namespace mbgl {
@@ -26,6 +27,11 @@ public:
 
     StyleParseResult parse(const std::string&);
 
+    // When set, layers that have a zoom range and aren't referenced by other layers are only
+    // partially converted: the resulting layer has its ID, type, source and zoom range but is
+    // hidden, and keeps its JSON in Layer::deferredJSON so that it can be converted once needed.
+    bool deferLayers = false;
+
     std::string spriteURL;
     std::string glyphURL;
 
@@ -50,10 +56,14 @@ private:
     void parseSources(const JSValue&);
     void parseLayers(const JSValue&);
     void parseLayer(const std::string& id, const JSValue&, std::unique_ptr<Layer>&);
+    void parseDeferredLayer(const std::string& id, const JSValue&, std::unique_ptr<Layer>&);
 
     std::unordered_map<std::string, const Source*> sourcesMap;
     std::unordered_map<std::string, std::pair<const JSValue&, std::unique_ptr<Layer>>> layersMap;
 
+    // IDs of layers that other layers reference with "ref". These are never deferred.
+    std::unordered_set<std::string> referencedLayers;
+
     // Store a stack of layer IDs we're parsing right now. This is to prevent reference cycles.
     std::forward_list<std::string> stack;
 };
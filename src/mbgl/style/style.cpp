@@ -130,5 +130,9 @@ std::unique_ptr<Layer> Style::removeLayer(const std::string& id) {
     return impl->removeLayer(id);
 }
 
+void Style::setDeferredLayerParsing(bool defer) {
+    impl->deferLayerParsing = defer;
+}
+
 } // namespace style
 } // namespace mbgl
@@ -78,6 +78,7 @@ void Style::Impl::loadURL(const std::string& url_) {
 
 void Style::Impl::parse(const std::string& json_) {
     Parser parser;
+    parser.deferLayers = deferLayerParsing;
 
     if (auto error = parser.parse(json_)) {
         std::string message = "Failed to parse style: " + util::toString(error);
@@ -93,6 +94,7 @@ void Style::Impl::parse(const std::string& json_) {
 
     sources.clear();
     layers.clear();
+    deferredLayers.clear();
     images.clear();
 
     transitionOptions = {};
@@ -103,6 +105,9 @@ void Style::Impl::parse(const std::string& json_) {
     }
 
     for (auto& layer : parser.layers) {
+        if (layer->deferredJSON) {
+            deferredLayers.insert(layer->getID());
+        }
         addLayer(std::move(layer));
     }
 
@@ -157,7 +162,8 @@ struct SourceIdUsageEvaluator {
 
     template <class LayerType>
     bool operator()(LayerType& layer) {
-        return layer.getSourceID() == sourceId;
+        // Reads the source from the impl, so that deferred layers aren't converted.
+        return layer.baseImpl->source == sourceId;
     }
 };
 
@@ -209,6 +215,7 @@ Layer* Style::Impl::addLayer(std::unique_ptr<Layer> layer, optional<std::string>
 }
 
 std::unique_ptr<Layer> Style::Impl::removeLayer(const std::string& id) {
+    deferredLayers.erase(id);
     std::unique_ptr<Layer> layer = layers.remove(id);
 
     if (layer) {
@@ -219,6 +226,34 @@ std::unique_ptr<Layer> Style::Impl::removeLayer(const std::string& id) {
     return layer;
 }
 
+void Style::Impl::parseDeferredLayers(float zoom) {
+    for (auto it = deferredLayers.begin(); it != deferredLayers.end();) {
+        Layer* layer = layers.get(*it);
+        if (!layer || !layer->deferredJSON) {
+            // Removed, or converted when one of its properties was accessed.
+            it = deferredLayers.erase(it);
+            continue;
+        }
+
+        // Convert layers a zoom level ahead of them becoming visible, so that tiles have been
+        // laid out for them by the time they're drawn.
+        if (layer->getMinZoom() > zoom + 1 || layer->getMaxZoom() <= zoom - 1) {
+            ++it;
+            continue;
+        }
+
+        // The observer isn't notified, since this happens while preparing an update; the converted
+        // layer is picked up by that update.
+        if (layer->convertDeferred()) {
+            layers.update(*layer);
+        } else {
+            // Like layers that fail to convert while parsing, drop the layer.
+            layers.remove(*it);
+        }
+        it = deferredLayers.erase(it);
+    }
+}
+
 void Style::Impl::setLight(std::unique_ptr<Light> light_) {
     light = std::move(light_);
     light->setObserver(this);
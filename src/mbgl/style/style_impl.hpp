@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace mbgl {
 
@@ -70,6 +71,10 @@ public:
                     optional<std::string> beforeLayerID = {});
     std::unique_ptr<Layer> removeLayer(const std::string& layerID);
 
+    // Converts layers whose conversion was deferred when the style was parsed, and whose zoom range
+    // is near the given zoom level. Other deferred layers are converted when they are accessed.
+    void parseDeferredLayers(float zoom);
+
     std::string getName() const;
     CameraOptions getDefaultCamera() const;
 
@@ -94,6 +99,7 @@ public:
     bool mutated = false;
     bool loaded = false;
     bool spriteLoaded = false;
+    bool deferLayerParsing = false;
 
 private:
     void parse(const std::string&);
@@ -112,6 +118,10 @@ private:
     Collection<Source> sources;
     Collection<Layer> layers;
     TransitionOptions transitionOptions;
+
+    // IDs of layers that may still be deferred.
+    std::unordered_set<std::string> deferredLayers;
+
     std::unique_ptr<Light> light;
 
     // Defaults
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <set>
 #include <string>
 #include <vector>
 #include <memory>
@@ -19,12 +18,17 @@ public:
     BiDi();
     ~BiDi();
 
-    std::vector<std::u16string> processText(const std::u16string&, std::set<std::size_t>);
+    // Splits the text into lines at the given break points, which must be sorted, and reorders
+    // every line for display. Paragraph ends are added to the break points. Lines are written to
+    // `lines`, reusing the storage of the strings that are already in it.
+    void processText(const std::u16string&,
+                     std::vector<std::size_t>& lineBreakPoints,
+                     std::vector<std::u16string>& lines);
 
 private:
-    void mergeParagraphLineBreaks(std::set<std::size_t>&);
-    std::vector<std::u16string> applyLineBreaking(std::set<std::size_t>);
-    std::u16string getLine(std::size_t start, std::size_t end);
+    void mergeParagraphLineBreaks(std::vector<std::size_t>&);
+    void applyLineBreaking(std::vector<std::size_t>&, std::vector<std::u16string>&);
+    void getLine(std::size_t start, std::size_t end, std::u16string& line);
 
     std::unique_ptr<BiDiImpl> impl;
 };
@@ -1,6 +1,7 @@
 #include <mbgl/text/glyph_manager.hpp>
 #include <mbgl/text/glyph_manager_observer.hpp>
 #include <mbgl/text/glyph_pbf.hpp>
+#include <mbgl/text/shaping_cache.hpp>
 #include <mbgl/storage/file_source.hpp>
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/storage/response.hpp>
@@ -11,7 +12,8 @@ static GlyphManagerObserver nullObserver;
 
 GlyphManager::GlyphManager(FileSource& fileSource_)
     : fileSource(fileSource_),
-      observer(&nullObserver) {
+      observer(&nullObserver),
+      shapingCache(std::make_shared<ShapingCache>()) {
 }
 
 GlyphManager::~GlyphManager() = default;
@@ -7,6 +7,7 @@
 #include <mbgl/util/font_stack.hpp>
 #include <mbgl/util/immutable.hpp>
 
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -15,6 +16,7 @@ namespace mbgl {
 class FileSource;
 class AsyncRequest;
 class Response;
+class ShapingCache;
 
 class GlyphRequestor {
 public:
@@ -41,6 +43,12 @@ public:
 
     void setObserver(GlyphManagerObserver*);
 
+    // Shaping results depend on the glyph metrics provided by this GlyphManager, so the
+    // cache is shared by all workers laying out tiles with its glyphs.
+    std::shared_ptr<ShapingCache> getShapingCache() const {
+        return shapingCache;
+    }
+
 private:
     FileSource& fileSource;
     std::string glyphURL;
@@ -63,6 +71,8 @@ private:
     void notify(GlyphRequestor&, const GlyphDependencies&);
 
     GlyphManagerObserver* observer = nullptr;
+
+    std::shared_ptr<ShapingCache> shapingCache;
 };
 
 } // namespace mbgl
@@ -4,8 +4,6 @@
 #include <mbgl/math/minmax.hpp>
 #include <mbgl/text/bidi.hpp>
 
-#include <boost/algorithm/string.hpp>
-
 #include <algorithm>
 #include <cmath>
 
@@ -112,74 +110,73 @@ float calculatePenalty(char16_t codePoint, char16_t nextCodePoint) {
     return penalty;
 }
 
-struct PotentialBreak {
-    PotentialBreak(const std::size_t p_index, const float p_x, const PotentialBreak* p_priorBreak, const float p_badness)
-    : index(p_index), x(p_x), priorBreak(p_priorBreak), badness(p_badness)
-    {}
-    
-    const std::size_t index;
-    const float x;
-    const PotentialBreak* priorBreak;
-    const float badness;
-};
-
-
-PotentialBreak evaluateBreak(const std::size_t breakIndex, const float breakX, const float targetWidth, const std::list<PotentialBreak>& potentialBreaks, const float penalty, const bool isLastBreak) {
+PotentialBreak evaluateBreak(const std::size_t breakIndex, const float breakX, const float targetWidth, const std::vector<PotentialBreak>& potentialBreaks, const float penalty, const bool isLastBreak) {
     // We could skip evaluating breaks where the line length (breakX - priorBreak.x) > maxWidth
     //  ...but in fact we allow lines longer than maxWidth (if there's no break points)
     //  ...and when targetWidth and maxWidth are close, strictly enforcing maxWidth can give
     //     more lopsided results.
     
-    const PotentialBreak* bestPriorBreak = nullptr;
+    int32_t bestPriorBreak = -1;
     float bestBreakBadness = calculateBadness(breakX, targetWidth, penalty, isLastBreak);
-    for (const auto& potentialBreak : potentialBreaks) {
+    for (std::size_t i = 0; i < potentialBreaks.size(); i++) {
+        const PotentialBreak& potentialBreak = potentialBreaks[i];
         const float lineWidth = breakX - potentialBreak.x;
         float breakBadness =
         calculateBadness(lineWidth, targetWidth, penalty, isLastBreak) + potentialBreak.badness;
         if (breakBadness <= bestBreakBadness) {
-            bestPriorBreak = &potentialBreak;
+            bestPriorBreak = static_cast<int32_t>(i);
             bestBreakBadness = breakBadness;
         }
     }
     
-    return PotentialBreak(breakIndex, breakX, bestPriorBreak, bestBreakBadness);
+    return PotentialBreak { breakIndex, breakX, bestPriorBreak, bestBreakBadness };
 }
 
-std::set<std::size_t> leastBadBreaks(const PotentialBreak& lastLineBreak) {
-    std::set<std::size_t> leastBadBreaks = { lastLineBreak.index };
-    const PotentialBreak* priorBreak = lastLineBreak.priorBreak;
-    while (priorBreak) {
-        leastBadBreaks.insert(priorBreak->index);
-        priorBreak = priorBreak->priorBreak;
+void leastBadBreaks(const PotentialBreak& lastLineBreak,
+                    const std::vector<PotentialBreak>& potentialBreaks,
+                    std::vector<std::size_t>& leastBadBreaks) {
+    leastBadBreaks.push_back(lastLineBreak.index);
+    int32_t priorBreak = lastLineBreak.priorBreak;
+    while (priorBreak >= 0) {
+        leastBadBreaks.push_back(potentialBreaks[priorBreak].index);
+        priorBreak = potentialBreaks[priorBreak].priorBreak;
     }
-    return leastBadBreaks;
+    // Prior breaks always precede the break that refers to them.
+    std::reverse(leastBadBreaks.begin(), leastBadBreaks.end());
 }
 
+static bool isWhitespace(char16_t chr) {
+    return chr == u' ' || chr == u'\t' || chr == u'\n' || chr == u'\v' || chr == u'\f' || chr == u'\r';
+}
 
 // We determine line breaks based on shaped text in logical order. Working in visual order would be
 //  more intuitive, but we can't do that because the visual order may be changed by line breaks!
-std::set<std::size_t> determineLineBreaks(const std::u16string& logicalInput,
-                                          const float spacing,
-                                          float maxWidth,
-                                          const WritingModeType writingMode,
-                                          const Glyphs& glyphs) {
+void determineLineBreaks(const std::u16string& logicalInput,
+                         const float spacing,
+                         float maxWidth,
+                         const WritingModeType writingMode,
+                         const Glyphs& glyphs,
+                         ShapingBuffers& buffers) {
+    std::vector<PotentialBreak>& potentialBreaks = buffers.potentialBreaks;
+    potentialBreaks.clear();
+    buffers.lineBreaks.clear();
+
     if (!maxWidth || writingMode != WritingModeType::Horizontal) {
-        return {};
+        return;
     }
     
     if (logicalInput.empty()) {
-        return {};
+        return;
     }
     
     const float targetWidth = determineAverageLineWidth(logicalInput, spacing, maxWidth, glyphs);
     
-    std::list<PotentialBreak> potentialBreaks;
     float currentX = 0;
     
     for (std::size_t i = 0; i < logicalInput.size(); i++) {
         const char16_t codePoint = logicalInput[i];
         auto it = glyphs.find(codePoint);
-        if (it != glyphs.end() && it->second && !boost::algorithm::is_any_of(u" \t\n\v\f\r")(codePoint)) {
+        if (it != glyphs.end() && it->second && !isWhitespace(codePoint)) {
             currentX += (*it->second)->metrics.advance + spacing;
         }
         
@@ -193,7 +190,8 @@ std::set<std::size_t> determineLineBreaks(const std::u16string& logicalInput,
         }
     }
     
-    return leastBadBreaks(evaluateBreak(logicalInput.size(), currentX, targetWidth, potentialBreaks, 0, true));
+    leastBadBreaks(evaluateBreak(logicalInput.size(), currentX, targetWidth, potentialBreaks, 0, true),
+                   potentialBreaks, buffers.lineBreaks);
 }
 
 void shapeLines(Shaping& shaping,
@@ -218,17 +216,19 @@ void shapeLines(Shaping& shaping,
         textJustify == style::TextJustifyType::Left ? 0 :
         0.5;
     
-    for (std::u16string line : lines) {
+    for (const std::u16string& line : lines) {
         // Collapse whitespace so it doesn't throw off justification
-        boost::algorithm::trim_if(line, boost::algorithm::is_any_of(u" \t\n\v\f\r"));
+        auto lineBegin = std::find_if_not(line.begin(), line.end(), isWhitespace);
+        auto lineEnd = std::find_if_not(line.rbegin(), std::u16string::const_reverse_iterator(lineBegin), isWhitespace).base();
         
-        if (line.empty()) {
+        if (lineBegin == lineEnd) {
             y += lineHeight; // Still need a line feed after empty line
             continue;
         }
         
         std::size_t lineStartIndex = shaping.positionedGlyphs.size();
-        for (char16_t chr : line) {
+        for (auto chrIt = lineBegin; chrIt != lineEnd; ++chrIt) {
+            const char16_t chr = *chrIt;
             auto it = glyphs.find(chr);
             if (it == glyphs.end() || !it->second) {
                 continue;
@@ -316,14 +316,14 @@ const Shaping getShaping(const std::u16string& logicalInput,
                          const float verticalHeight,
                          const WritingModeType writingMode,
                          BiDi& bidi,
+                         ShapingBuffers& buffers,
                          const Glyphs& glyphs) {
     Shaping shaping(translate.x, translate.y, writingMode);
     
-    std::vector<std::u16string> reorderedLines =
-    bidi.processText(logicalInput,
-                     determineLineBreaks(logicalInput, spacing, maxWidth, writingMode, glyphs));
+    determineLineBreaks(logicalInput, spacing, maxWidth, writingMode, glyphs, buffers);
+    bidi.processText(logicalInput, buffers.lineBreaks, buffers.lines);
     
-    shapeLines(shaping, reorderedLines, spacing, lineHeight, textAnchor,
+    shapeLines(shaping, buffers.lines, spacing, lineHeight, textAnchor,
                textJustify, verticalHeight, writingMode, glyphs);
     
     return shaping;
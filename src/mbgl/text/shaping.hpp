@@ -42,6 +42,32 @@ public:
     float angle() const { return _angle; }
 };
 
+struct PotentialBreak {
+    std::size_t index;
+    float x;
+    // Index of the prior break in the list of potential breaks, or -1 for the start of the text.
+    int32_t priorBreak;
+    float badness;
+};
+
+// Scratch storage for getShaping(). Reusing one instance for all labels laid out by a worker
+// avoids allocating while determining line breaks and reordering lines. Like BiDi, an instance
+// must only be used by one thread at a time.
+class ShapingBuffers {
+public:
+    std::vector<PotentialBreak> potentialBreaks;
+    std::vector<std::size_t> lineBreaks;
+    std::vector<std::u16string> lines;
+};
+
+// Fills `lineBreaks` with the sorted indices at which the text should be broken to fit maxWidth.
+void determineLineBreaks(const std::u16string& logicalInput,
+                         const float spacing,
+                         float maxWidth,
+                         const WritingModeType,
+                         const Glyphs&,
+                         ShapingBuffers&);
+
 const Shaping getShaping(const std::u16string& string,
                          float maxWidth,
                          float lineHeight,
@@ -52,6 +78,7 @@ const Shaping getShaping(const std::u16string& string,
                          float verticalHeight,
                          const WritingModeType,
                          BiDi& bidi,
+                         ShapingBuffers&,
                          const Glyphs& glyphs);
 
 } // namespace mbgl
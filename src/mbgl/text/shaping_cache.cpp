@@ -0,0 +1,108 @@
+#include <mbgl/text/shaping_cache.hpp>
+#include <mbgl/util/font_stack.hpp>
+
+#include <boost/functional/hash.hpp>
+
+#include <tuple>
+
+namespace mbgl {
+
+bool ShapingCache::Key::operator==(const Key& other) const {
+    return std::tie(string, fontStack, maxWidth, lineHeight, textAnchor, textJustify, spacing,
+                    translateX, translateY, verticalHeight, writingMode, glyphCount) ==
+           std::tie(other.string, other.fontStack, other.maxWidth, other.lineHeight,
+                    other.textAnchor, other.textJustify, other.spacing, other.translateX,
+                    other.translateY, other.verticalHeight, other.writingMode, other.glyphCount);
+}
+
+std::size_t ShapingCache::KeyHash::operator()(const Key& key) const {
+    std::size_t seed = std::hash<std::u16string>()(key.string);
+    boost::hash_combine(seed, FontStackHash()(key.fontStack));
+    boost::hash_combine(seed, key.maxWidth);
+    boost::hash_combine(seed, key.lineHeight);
+    boost::hash_combine(seed, static_cast<uint8_t>(key.textAnchor));
+    boost::hash_combine(seed, static_cast<uint8_t>(key.textJustify));
+    boost::hash_combine(seed, key.spacing);
+    boost::hash_combine(seed, key.translateX);
+    boost::hash_combine(seed, key.translateY);
+    boost::hash_combine(seed, key.verticalHeight);
+    boost::hash_combine(seed, static_cast<uint8_t>(key.writingMode));
+    boost::hash_combine(seed, key.glyphCount);
+    return seed;
+}
+
+ShapingCache::ShapingCache(std::size_t maximumEntries_)
+    : maximumEntries(maximumEntries_) {
+}
+
+Shaping ShapingCache::get(const std::u16string& string,
+                          const FontStack& fontStack,
+                          const float maxWidth,
+                          const float lineHeight,
+                          const style::TextAnchorType textAnchor,
+                          const style::TextJustifyType textJustify,
+                          const float spacing,
+                          const Point<float>& translate,
+                          const float verticalHeight,
+                          const WritingModeType writingMode,
+                          BiDi& bidi,
+                          ShapingBuffers& buffers,
+                          const Glyphs& glyphs) {
+    std::size_t glyphCount = 0;
+    for (char16_t chr : string) {
+        auto it = glyphs.find(chr);
+        if (it != glyphs.end() && it->second) {
+            glyphCount++;
+        }
+    }
+
+    Key key { string, fontStack, maxWidth, lineHeight, textAnchor, textJustify, spacing,
+              translate.x, translate.y, verticalHeight, writingMode, glyphCount };
+
+    std::shared_ptr<const Shaping> shaping;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key);
+        if (it != index.end()) {
+            entries.splice(entries.begin(), entries, it->second);
+            shaping = it->second->second;
+        }
+    }
+
+    if (shaping) {
+        hitCount++;
+        return *shaping;
+    }
+
+    missCount++;
+    shaping = std::make_shared<const Shaping>(getShaping(string, maxWidth, lineHeight, textAnchor,
+                                                         textJustify, spacing, translate,
+                                                         verticalHeight, writingMode, bidi, buffers,
+                                                         glyphs));
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (index.find(key) == index.end()) {
+        entries.emplace_front(key, shaping);
+        index.emplace(std::move(key), entries.begin());
+
+        while (entries.size() > maximumEntries) {
+            index.erase(entries.back().first);
+            entries.pop_back();
+        }
+    }
+
+    return *shaping;
+}
+
+void ShapingCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    index.clear();
+    entries.clear();
+}
+
+std::size_t ShapingCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
+
+} // namespace mbgl
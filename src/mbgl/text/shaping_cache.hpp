@@ -0,0 +1,80 @@
+#pragma once
+
+#include <mbgl/text/shaping.hpp>
+#include <mbgl/util/noncopyable.hpp>
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace mbgl {
+
+// A bounded, thread-safe LRU cache of shaping results. It is shared by all tile workers that use
+// the same GlyphManager, so that labels which show up in many tiles and at many zoom levels
+// (e.g. street names) are shaped only once.
+class ShapingCache : private util::noncopyable {
+public:
+    ShapingCache(std::size_t maximumEntries = 4096);
+
+    // Same as getShaping(), but returns a previous result if the text has been shaped with the
+    // same font stack and parameters before.
+    Shaping get(const std::u16string& string,
+                const FontStack&,
+                float maxWidth,
+                float lineHeight,
+                style::TextAnchorType,
+                style::TextJustifyType,
+                float spacing,
+                const Point<float>& translate,
+                float verticalHeight,
+                const WritingModeType,
+                BiDi&,
+                ShapingBuffers&,
+                const Glyphs&);
+
+    void clear();
+
+    std::size_t size() const;
+    uint64_t hits() const { return hitCount; }
+    uint64_t misses() const { return missCount; }
+
+private:
+    struct Key {
+        std::u16string string;
+        FontStack fontStack;
+        float maxWidth;
+        float lineHeight;
+        style::TextAnchorType textAnchor;
+        style::TextJustifyType textJustify;
+        float spacing;
+        float translateX;
+        float translateY;
+        float verticalHeight;
+        WritingModeType writingMode;
+        // Glyphs may still be missing when a glyph range failed to load; counting the ones that
+        // are present makes sure we shape again once they arrive.
+        std::size_t glyphCount;
+
+        bool operator==(const Key&) const;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key&) const;
+    };
+
+    using Entry = std::pair<Key, std::shared_ptr<const Shaping>>;
+
+    const std::size_t maximumEntries;
+
+    mutable std::mutex mutex;
+    std::list<Entry> entries; // Most recently used first.
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index;
+
+    std::atomic<uint64_t> hitCount { 0 };
+    std::atomic<uint64_t> missCount { 0 };
+};
+
+} // namespace mbgl
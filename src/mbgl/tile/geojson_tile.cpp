@@ -1,8 +1,8 @@
 #include <mbgl/tile/geojson_tile.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
 #include <mbgl/renderer/query.hpp>
+#include <mbgl/renderer/source_feature_query.hpp>
 #include <mbgl/renderer/tile_parameters.hpp>
-#include <mbgl/style/filter_evaluator.hpp>
 #include <mbgl/util/string.hpp>
 
 #include <mapbox/geojsonvt.hpp>
@@ -113,25 +113,13 @@ void GeoJSONTile::updateData(mapbox::geometry::feature_collection<int16_t> featu
 
 void GeoJSONTile::setNecessity(Necessity) {}
     
-void GeoJSONTile::querySourceFeatures(
-    std::vector<Feature>& result,
-    const SourceQueryOptions& options) {
+void GeoJSONTile::querySourceFeatures(SourceFeatureQuery& query) {
     
     // Ignore the sourceLayer, there is only one
     auto layer = getData()->getLayer({});
     
     if (layer) {
-        auto featureCount = layer->featureCount();
-        for (std::size_t i = 0; i < featureCount; i++) {
-            auto feature = layer->getFeature(i);
-            
-            // Apply filter, if any
-            if (options.filter && !(*options.filter)(*feature)) {
-                continue;
-            }
-            
-            result.push_back(convertFeature(*feature, id.canonical));
-        }
+        query.addLayer(*layer, {}, id);
     }
 }
 
@@ -18,9 +18,7 @@ public:
 
     void setNecessity(Necessity) final;
     
-    void querySourceFeatures(
-        std::vector<Feature>& result,
-        const SourceQueryOptions&) override;
+    void querySourceFeatures(SourceFeatureQuery&) override;
 };
 
 } // namespace mbgl
@@ -11,13 +11,13 @@
 #include <mbgl/renderer/layers/render_symbol_layer.hpp>
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
 #include <mbgl/renderer/query.hpp>
+#include <mbgl/renderer/source_feature_query.hpp>
 #include <mbgl/text/glyph_atlas.hpp>
 #include <mbgl/renderer/image_atlas.hpp>
 #include <mbgl/storage/file_source.hpp>
 #include <mbgl/geometry/feature_index.hpp>
 #include <mbgl/text/collision_tile.hpp>
 #include <mbgl/map/transform_state.hpp>
-#include <mbgl/style/filter_evaluator.hpp>
 #include <mbgl/util/chrono.hpp>
 #include <mbgl/util/logging.hpp>
 #include <mbgl/actor/scheduler.hpp>
@@ -39,7 +39,9 @@ GeometryTile::GeometryTile(const OverscaledTileID& id_,
              id_,
              obsolete,
              parameters.mode,
-             parameters.pixelRatio),
+             parameters.pixelRatio,
+             parameters.glyphManager.getShapingCache(),
+             parameters.layoutCache),
       glyphManager(parameters.glyphManager),
       imageManager(parameters.imageManager),
       placementThrottler(Milliseconds(300), [this] { invokePlacement(); }),
@@ -210,16 +212,16 @@ Bucket* GeometryTile::getBucket(const Layer::Impl& layer) const {
     return it->second.get();
 }
 
-void GeometryTile::queryRenderedFeatures(
-    std::unordered_map<std::string, std::vector<Feature>>& result,
+bool GeometryTile::queryRenderedFeatures(
+    const RenderedFeatureCallback& callback,
     const GeometryCoordinates& queryGeometry,
     const TransformState& transformState,
     const RenderStyle& style,
     const RenderedQueryOptions& options) {
 
-    if (!featureIndex || !data) return;
+    if (!featureIndex || !data) return true;
 
-    featureIndex->query(result,
+    return featureIndex->query(callback,
                         queryGeometry,
                         transformState.getAngle(),
                         util::tileSize * id.overscaleFactor(),
@@ -232,9 +234,7 @@ void GeometryTile::queryRenderedFeatures(
                         *this);
 }
 
-void GeometryTile::querySourceFeatures(
-    std::vector<Feature>& result,
-    const SourceQueryOptions& options) {
+void GeometryTile::querySourceFeatures(SourceFeatureQuery& query) {
 
     // Data not yet available
     if (!data) {
@@ -242,28 +242,18 @@ void GeometryTile::querySourceFeatures(
     }
     
     // No source layers, specified, nothing to do
-    if (!options.sourceLayers) {
+    if (!query.options.sourceLayers) {
         Log::Warning(Event::General, "At least one sourceLayer required");
         return;
     }
 
-    for (auto sourceLayer : *options.sourceLayers) {
+    for (const auto& sourceLayer : *query.options.sourceLayers) {
         // Go throught all sourceLayers, if any
         // to gather all the features
         auto layer = data->getLayer(sourceLayer);
         
         if (layer) {
-            auto featureCount = layer->featureCount();
-            for (std::size_t i = 0; i < featureCount; i++) {
-                auto feature = layer->getFeature(i);
-
-                // Apply filter, if any
-                if (options.filter && !(*options.filter)(*feature)) {
-                    continue;
-                }
-
-                result.push_back(convertFeature(*feature, id.canonical));
-            }
+            query.addLayer(*layer, sourceLayer, id);
         }
     }
 }
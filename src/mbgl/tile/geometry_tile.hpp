@@ -52,16 +52,14 @@ public:
     Size bindGlyphAtlas(gl::Context&);
     Size bindIconAtlas(gl::Context&);
 
-    void queryRenderedFeatures(
-            std::unordered_map<std::string, std::vector<Feature>>& result,
+    bool queryRenderedFeatures(
+            const RenderedFeatureCallback&,
             const GeometryCoordinates& queryGeometry,
             const TransformState&,
             const RenderStyle&,
             const RenderedQueryOptions& options) override;
 
-    void querySourceFeatures(
-        std::vector<Feature>& result,
-        const SourceQueryOptions&) override;
+    void querySourceFeatures(SourceFeatureQuery&) override;
 
     void cancel() override;
 
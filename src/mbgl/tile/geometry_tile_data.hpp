@@ -67,6 +67,12 @@ public:
     // Returns the layer with the given name. The returned layer object *may* outlive the data
     // object.
     virtual std::unique_ptr<GeometryTileLayer> getLayer(const std::string&) const = 0;
+
+    // Returns a key that identifies the contents of this tile, for use with the layout cache. Data
+    // that doesn't have a stable serialized form returns an empty optional.
+    virtual optional<std::string> contentKey() const {
+        return {};
+    }
 };
 
 // classifies an array of rings into polygons with outer rings and holes
@@ -75,6 +81,9 @@ std::vector<GeometryCollection> classifyRings(const GeometryCollection&);
 // Truncate polygon to the largest `maxHoles` inner rings by area.
 void limitHoles(GeometryCollection&, uint32_t maxHoles);
 
+// convert from GeometryTileFeature geometry to latitude/longitude based geometry
+Feature::geometry_type convertGeometry(const GeometryTileFeature&, const CanonicalTileID&);
+
 // convert from GeometryTileFeature to Feature (eventually we should eliminate GeometryTileFeature)
 Feature convertFeature(const GeometryTileFeature&, const CanonicalTileID&);
 
@@ -1,7 +1,9 @@
 #include <mbgl/tile/geometry_tile_worker.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
 #include <mbgl/tile/geometry_tile.hpp>
+#include <mbgl/tile/layout_cache.hpp>
 #include <mbgl/text/collision_tile.hpp>
+#include <mbgl/text/shaping_cache.hpp>
 #include <mbgl/layout/symbol_layout.hpp>
 #include <mbgl/renderer/bucket_parameters.hpp>
 #include <mbgl/renderer/group_by_layout.hpp>
@@ -9,6 +11,8 @@
 #include <mbgl/style/filter_evaluator.hpp>
 #include <mbgl/style/layers/symbol_layer_impl.hpp>
 #include <mbgl/renderer/layers/render_symbol_layer.hpp>
+#include <mbgl/renderer/buckets/fill_bucket.hpp>
+#include <mbgl/renderer/buckets/line_bucket.hpp>
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
 #include <mbgl/util/logging.hpp>
 #include <mbgl/util/constants.hpp>
@@ -26,13 +30,17 @@ GeometryTileWorker::GeometryTileWorker(ActorRef<GeometryTileWorker> self_,
                                        OverscaledTileID id_,
                                        const std::atomic<bool>& obsolete_,
                                        const MapMode mode_,
-                                       const float pixelRatio_)
+                                       const float pixelRatio_,
+                                       std::shared_ptr<ShapingCache> shapingCache_,
+                                       std::shared_ptr<LayoutCache> layoutCache_)
     : self(std::move(self_)),
       parent(std::move(parent_)),
       id(std::move(id_)),
       obsolete(obsolete_),
       mode(mode_),
-      pixelRatio(pixelRatio_) {
+      pixelRatio(pixelRatio_),
+      shapingCache(std::move(shapingCache_)),
+      layoutCache(std::move(layoutCache_)) {
 }
 
 GeometryTileWorker::~GeometryTileWorker() = default;
@@ -290,6 +298,24 @@ void GeometryTileWorker::redoLayout() {
     std::vector<std::unique_ptr<RenderLayer>> renderLayers = toRenderLayers(*layers, id.overscaledZ);
     std::vector<std::vector<const RenderLayer*>> groups = groupByLayout(renderLayers);
 
+    // Buckets are cached per tile data, zoom level and overscale factor, which determine the
+    // evaluated layout properties and line geometry, and per serialization format. The cached entry
+    // is rewritten with the buckets of the current layer groups whenever one of them had to be
+    // laid out.
+    optional<std::string> tileKey;
+    LayoutCache::Buckets cachedBuckets;
+    LayoutCache::Buckets updatedBuckets;
+    bool cacheNeedsUpdate = false;
+    if (layoutCache && *data) {
+        if (optional<std::string> contentKey = (*data)->contentKey()) {
+            static const std::string format =
+                FillBucket::serializationFormat() + ";" + LineBucket::serializationFormat();
+            tileKey = format + "/" + util::toString(id.canonical.z) + "/" +
+                      util::toString(id.overscaledZ) + "/" + *contentKey;
+            cachedBuckets = layoutCache->get(*tileKey);
+        }
+    }
+
     for (auto& group : groups) {
         if (obsolete) {
             return;
@@ -323,6 +349,29 @@ void GeometryTileWorker::redoLayout() {
             const std::string& sourceLayerID = leader.baseImpl->sourceLayer;
             std::shared_ptr<Bucket> bucket = leader.createBucket(parameters, group);
 
+            std::string bucketKey;
+            bool cached = false;
+            if (tileKey) {
+                bucketKey = layoutKey(leader);
+                auto it = cachedBuckets.find(bucketKey);
+                if (it != cachedBuckets.end()) {
+                    try {
+                        cached = bucket->deserialize(it->second);
+                    } catch (const std::exception& error) {
+                        // Don't trust the rest of a corrupt entry either; lay out the remaining
+                        // groups from scratch and replace the entry.
+                        Log::Warning(Event::ParseTile, "Could not load cached bucket: %s", error.what());
+                        cachedBuckets.clear();
+                        cacheNeedsUpdate = true;
+                    }
+                    if (cached) {
+                        updatedBuckets.emplace(bucketKey, std::move(it->second));
+                    }
+                }
+            }
+
+            // The feature index isn't cached, so features are still filtered and indexed when the
+            // bucket was loaded from the cache.
             for (std::size_t i = 0; !obsolete && i < geometryLayer->featureCount(); i++) {
                 std::unique_ptr<GeometryTileFeature> feature = geometryLayer->getFeature(i);
 
@@ -330,10 +379,19 @@ void GeometryTileWorker::redoLayout() {
                     continue;
 
                 GeometryCollection geometries = feature->getGeometries();
-                bucket->addFeature(*feature, geometries);
+                if (!cached) {
+                    bucket->addFeature(*feature, geometries);
+                }
                 featureIndex->insert(geometries, i, sourceLayerID, leader.getID());
             }
 
+            if (tileKey && !cached && !obsolete) {
+                if (optional<std::string> serialized = bucket->serialize()) {
+                    updatedBuckets.emplace(bucketKey, std::move(*serialized));
+                    cacheNeedsUpdate = true;
+                }
+            }
+
             if (!bucket->hasData()) {
                 continue;
             }
@@ -344,6 +402,10 @@ void GeometryTileWorker::redoLayout() {
         }
     }
 
+    if (cacheNeedsUpdate) {
+        layoutCache->put(*tileKey, updatedBuckets);
+    }
+
     symbolLayouts.clear();
     for (const auto& symbolLayerID : symbolOrder) {
         auto it = symbolLayoutMap.find(symbolLayerID);
@@ -395,7 +457,8 @@ void GeometryTileWorker::attemptPlacement() {
             }
 
             symbolLayout->prepare(glyphMap, glyphAtlas.positions,
-                                  imageMap, imageAtlas.positions);
+                                  imageMap, imageAtlas.positions,
+                                  *shapingCache, bidi, shapingBuffers);
         }
 
         symbolLayoutsNeedPreparation = false;
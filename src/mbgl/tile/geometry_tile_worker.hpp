@@ -5,6 +5,8 @@
 #include <mbgl/style/image_impl.hpp>
 #include <mbgl/text/glyph.hpp>
 #include <mbgl/text/placement_config.hpp>
+#include <mbgl/text/bidi.hpp>
+#include <mbgl/text/shaping.hpp>
 #include <mbgl/actor/actor_ref.hpp>
 #include <mbgl/util/optional.hpp>
 #include <mbgl/util/immutable.hpp>
@@ -18,6 +20,8 @@ namespace mbgl {
 class GeometryTile;
 class GeometryTileData;
 class SymbolLayout;
+class ShapingCache;
+class LayoutCache;
 
 namespace style {
 class Layer;
@@ -30,7 +34,9 @@ public:
                        OverscaledTileID,
                        const std::atomic<bool>&,
                        const MapMode,
-                       const float pixelRatio);
+                       const float pixelRatio,
+                       std::shared_ptr<ShapingCache>,
+                       std::shared_ptr<LayoutCache>);
     ~GeometryTileWorker();
 
     void setLayers(std::vector<Immutable<style::Layer::Impl>>, uint64_t correlationID);
@@ -60,6 +66,13 @@ private:
     const std::atomic<bool>& obsolete;
     const MapMode mode;
     const float pixelRatio;
+    const std::shared_ptr<ShapingCache> shapingCache;
+    const std::shared_ptr<LayoutCache> layoutCache;
+
+    // Line breaking state reused across every label this worker shapes. Use of the
+    // BiDi/ubiditransform object must be constrained to one thread.
+    BiDi bidi;
+    ShapingBuffers shapingBuffers;
 
     enum State {
         Idle,
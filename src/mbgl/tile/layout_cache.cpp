@@ -0,0 +1,285 @@
+#include <mbgl/tile/layout_cache.hpp>
+#include <mbgl/util/fnv_hash.hpp>
+#include <mbgl/util/io.hpp>
+#include <mbgl/util/logging.hpp>
+#include <mbgl/util/string.hpp>
+
+#include <protozero/pbf_reader.hpp>
+#include <protozero/pbf_writer.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace mbgl {
+
+namespace {
+
+// Number of puts after which the index is saved. It is also saved when the cache is destroyed.
+const uint32_t indexSavePutCount = 32;
+
+// Writes to a temporary file that is renamed into place, so that concurrent readers and writers of
+// the same entry never see a partially written file.
+void writeFileAtomically(const std::string& path, const std::string& data) {
+    static std::atomic<uint64_t> counter { 0 };
+    const std::string temporaryPath = path + "." +
+        util::toString(std::chrono::steady_clock::now().time_since_epoch().count()) + "-" +
+        util::toString(counter++) + ".tmp";
+
+    util::write_file(temporaryPath, data);
+    if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+        std::remove(temporaryPath.c_str());
+        throw std::runtime_error(std::string("Failed to move file into place: ") + path);
+    }
+}
+
+void removeFiles(const std::vector<std::string>& paths) {
+    for (const auto& path : paths) {
+        std::remove(path.c_str());
+    }
+}
+
+} // namespace
+
+LayoutCache::LayoutCache(std::string directory_, uint64_t maximumSize_)
+    : directory(std::move(directory_)),
+      maximumSize(maximumSize_) {
+    loadIndex();
+}
+
+LayoutCache::~LayoutCache() {
+    saveIndex(true);
+}
+
+std::string LayoutCache::path(uint64_t hash) const {
+    std::ostringstream ss;
+    ss << directory << "/com.mapbox.gl.layout." << std::setfill('0')
+       << std::setw(16) << std::hex << hash << ".pbf";
+    return ss.str();
+}
+
+std::string LayoutCache::indexPath() const {
+    return directory + "/com.mapbox.gl.layout.index";
+}
+
+uint64_t LayoutCache::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return totalSize;
+}
+
+void LayoutCache::loadIndex() {
+    try {
+        const optional<std::string> data = util::readFile(indexPath());
+        if (!data) {
+            return;
+        }
+
+        protozero::pbf_reader pbf(*data);
+        while (pbf.next(1 /* entry */)) {
+            protozero::pbf_reader pbf_entry = pbf.get_message();
+            uint64_t hash = 0;
+            uint64_t entrySize = 0;
+            while (pbf_entry.next()) {
+                switch (pbf_entry.tag()) {
+                case 1: // hash
+                    hash = pbf_entry.get_fixed64();
+                    break;
+                case 2: // size
+                    entrySize = pbf_entry.get_uint64();
+                    break;
+                default:
+                    pbf_entry.skip();
+                    break;
+                }
+            }
+            touch(hash, entrySize);
+        }
+    } catch (std::exception& error) {
+        Log::Warning(Event::ParseTile, "Could not load layout cache index: %s", error.what());
+    }
+    indexDirty = false;
+}
+
+void LayoutCache::saveIndex(bool wait) {
+    // Index writes are serialized, so that an older snapshot of the index never replaces a newer
+    // one. Unless asked to wait, a write is skipped while another one is in progress; the index
+    // stays dirty and is saved later.
+    std::unique_lock<std::mutex> indexLock(indexMutex, std::defer_lock);
+    if (wait) {
+        indexLock.lock();
+    } else if (!indexLock.try_lock()) {
+        return;
+    }
+
+    std::string data;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!indexDirty) {
+            return;
+        }
+
+        protozero::pbf_writer pbf(data);
+        for (const uint64_t hash : order) {
+            protozero::pbf_writer pbf_entry(pbf, 1 /* entry */);
+            pbf_entry.add_fixed64(1 /* hash */, hash);
+            pbf_entry.add_uint64(2 /* size */, entries.at(hash).size);
+        }
+        indexDirty = false;
+        unsavedPuts = 0;
+    }
+
+    try {
+        writeFileAtomically(indexPath(), data);
+    } catch (std::runtime_error& error) {
+        Log::Warning(Event::ParseTile, "Failed to save layout cache index: %s", error.what());
+        std::lock_guard<std::mutex> lock(mutex);
+        indexDirty = true;
+    }
+}
+
+bool LayoutCache::touch(uint64_t hash, uint64_t entrySize) {
+    auto it = entries.find(hash);
+    const bool known = it != entries.end();
+    if (known) {
+        totalSize -= it->second.size;
+        it->second.size = entrySize;
+        order.splice(order.end(), order, it->second.position);
+    } else {
+        entries.emplace(hash, Entry { entrySize, order.insert(order.end(), hash) });
+    }
+    totalSize += entrySize;
+    indexDirty = true;
+    return known;
+}
+
+void LayoutCache::remove(uint64_t hash) {
+    auto it = entries.find(hash);
+    if (it != entries.end()) {
+        totalSize -= it->second.size;
+        order.erase(it->second.position);
+        entries.erase(it);
+        indexDirty = true;
+    }
+}
+
+std::vector<std::string> LayoutCache::evict() {
+    std::vector<std::string> evicted;
+    while (totalSize > maximumSize && !order.empty()) {
+        const uint64_t hash = order.front();
+        evicted.push_back(path(hash));
+        remove(hash);
+    }
+    return evicted;
+}
+
+LayoutCache::Buckets LayoutCache::get(const std::string& tileKey) {
+    Buckets result;
+    const uint64_t hash = util::fnvHash(tileKey);
+
+    try {
+        const optional<std::string> data = util::readFile(path(hash));
+        if (!data) {
+            std::lock_guard<std::mutex> lock(mutex);
+            remove(hash);
+            return {};
+        }
+
+        bool hasKey = false;
+        protozero::pbf_reader pbf(*data);
+        while (pbf.next()) {
+            switch (pbf.tag()) {
+            case 1: // key
+                // Different tiles may hash to the same file.
+                if (pbf.get_string() != tileKey) {
+                    return {};
+                }
+                hasKey = true;
+                break;
+            case 2: { // bucket
+                protozero::pbf_reader pbf_bucket = pbf.get_message();
+                std::string layoutKey;
+                std::string bucket;
+                while (pbf_bucket.next()) {
+                    switch (pbf_bucket.tag()) {
+                    case 1: // layout key
+                        layoutKey = pbf_bucket.get_string();
+                        break;
+                    case 2: // data
+                        bucket = pbf_bucket.get_bytes();
+                        break;
+                    default:
+                        pbf_bucket.skip();
+                        break;
+                    }
+                }
+                result.emplace(std::move(layoutKey), std::move(bucket));
+                break;
+            }
+            default:
+                pbf.skip();
+                break;
+            }
+        }
+
+        if (!hasKey) {
+            throw std::runtime_error("Cached layout is missing its key");
+        }
+
+        std::vector<std::string> evicted;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!touch(hash, data->size())) {
+                // Written by another instance that shares the directory.
+                evicted = evict();
+            }
+        }
+        removeFiles(evicted);
+    } catch (std::exception& error) {
+        Log::Warning(Event::ParseTile, "Could not load cached layout: %s", error.what());
+        return {};
+    }
+
+    return result;
+}
+
+void LayoutCache::put(const std::string& tileKey, const Buckets& buckets) {
+    const uint64_t hash = util::fnvHash(tileKey);
+
+    std::string data;
+    {
+        protozero::pbf_writer pbf(data);
+        pbf.add_string(1 /* key */, tileKey);
+        for (const auto& bucket : buckets) {
+            protozero::pbf_writer pbf_bucket(pbf, 2 /* bucket */);
+            pbf_bucket.add_string(1 /* layout key */, bucket.first);
+            pbf_bucket.add_bytes(2 /* data */, bucket.second);
+        }
+    }
+
+    try {
+        writeFileAtomically(path(hash), data);
+    } catch (std::runtime_error& error) {
+        Log::Warning(Event::ParseTile, "Failed to cache layout: %s", error.what());
+        return;
+    }
+
+    std::vector<std::string> evicted;
+    bool saveNeeded;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        touch(hash, data.size());
+        evicted = evict();
+        saveNeeded = ++unsavedPuts >= indexSavePutCount;
+    }
+    removeFiles(evicted);
+
+    if (saveNeeded) {
+        saveIndex(false);
+    }
+}
+
+} // namespace mbgl
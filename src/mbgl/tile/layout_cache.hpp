@@ -0,0 +1,76 @@
+#pragma once
+
+#include <mbgl/util/noncopyable.hpp>
+
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace mbgl {
+
+// Stores the laid out buckets of vector tiles on disk, so that tiles with the same data and layer
+// layouts don't need to be tessellated again when they are loaded in a later session. Entries are
+// kept in one file per tile in the given directory, which must already exist. Files are replaced
+// atomically, and the least recently used entries are deleted once the total size of the entries
+// exceeds the maximum size. All methods may be called from any worker thread. Files are written
+// and deleted without holding the lock that guards the index, so that workers don't wait for
+// each other's disk I/O.
+class LayoutCache : private util::noncopyable {
+public:
+    // Serialized buckets of a tile, keyed by the layout key of their layer group.
+    using Buckets = std::unordered_map<std::string, std::string>;
+
+    LayoutCache(std::string directory, uint64_t maximumSize = 50 * 1024 * 1024);
+    ~LayoutCache();
+
+    // Returns the buckets stored for the tile with the given key, or an empty map if there are none
+    // or the entry can't be read.
+    Buckets get(const std::string& tileKey);
+
+    // Replaces the buckets stored for the tile with the given key.
+    void put(const std::string& tileKey, const Buckets&);
+
+    // Total size of the entries known to this cache, in bytes.
+    uint64_t size() const;
+
+private:
+    std::string path(uint64_t hash) const;
+    std::string indexPath() const;
+
+    // The index records the size and use order of all entries, so that the cache size is bounded
+    // across sessions. It is rewritten after a number of puts and when the cache is destroyed.
+    // Entries written by other instances that share the directory are added to the index when
+    // they are first read.
+    void loadIndex();
+    void saveIndex(bool wait);
+
+    // Marks the entry as most recently used, and returns whether it was already known.
+    bool touch(uint64_t hash, uint64_t entrySize);
+    void remove(uint64_t hash);
+    // Removes the least recently used entries from the index until the cache fits its maximum
+    // size, and returns the paths of the files to delete.
+    std::vector<std::string> evict();
+
+    const std::string directory;
+    const uint64_t maximumSize;
+
+    mutable std::mutex mutex;
+    // File hashes, least recently used first.
+    std::list<uint64_t> order;
+    struct Entry {
+        uint64_t size;
+        std::list<uint64_t>::iterator position;
+    };
+    std::unordered_map<uint64_t, Entry> entries;
+    uint64_t totalSize = 0;
+    bool indexDirty = false;
+    uint32_t unsavedPuts = 0;
+
+    // Held while the index file is written.
+    std::mutex indexMutex;
+};
+
+} // namespace mbgl
@@ -9,17 +9,36 @@
 #include <mbgl/renderer/tile_parameters.hpp>
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/actor/scheduler.hpp>
+#include <mbgl/util/tileset.hpp>
+
+#include <cmath>
 
 namespace mbgl {
 
+// Tiles are displayed at about their size in device pixels, so larger images are scaled down while
+// decoding. Tiles of the source's maximum zoom level keep their full resolution, since they're
+// magnified when zooming in further.
+static optional<Size> decodeSize(const OverscaledTileID& id,
+                                 const TileParameters& parameters,
+                                 const Tileset& tileset,
+                                 uint16_t tileSize) {
+    if (id.canonical.z >= tileset.zoomRange.max) {
+        return {};
+    }
+    const auto size = static_cast<uint32_t>(std::ceil(tileSize * parameters.pixelRatio));
+    return Size { size, size };
+}
+
 RasterTile::RasterTile(const OverscaledTileID& id_,
                        const TileParameters& parameters,
-                       const Tileset& tileset)
+                       const Tileset& tileset,
+                       uint16_t tileSize)
     : Tile(id_),
       loader(*this, id_, parameters, tileset),
       mailbox(std::make_shared<Mailbox>(*Scheduler::GetCurrent())),
       worker(parameters.workerScheduler,
-             ActorRef<RasterTile>(*this, mailbox)) {
+             ActorRef<RasterTile>(*this, mailbox),
+             decodeSize(id_, parameters, tileset, tileSize)) {
 }
 
 RasterTile::~RasterTile() = default;
@@ -33,17 +52,19 @@ void RasterTile::setError(std::exception_ptr err) {
     observer->onTileError(*this, err);
 }
 
-void RasterTile::setData(std::shared_ptr<const std::string> data,
+void RasterTile::setData(std::shared_ptr<const std::string> data_,
                              optional<Timestamp> modified_,
                              optional<Timestamp> expires_) {
     modified = modified_;
     expires = expires_;
+    data = data_;
     worker.invoke(&RasterTileWorker::parse, data);
 }
 
 void RasterTile::onParsed(std::unique_ptr<RasterBucket> result) {
     bucket = std::move(result);
     loaded = true;
+    pending = false;
     renderable = bucket ? true : false;
     observer->onTileChanged(*this);
 }
@@ -51,10 +72,30 @@ void RasterTile::onParsed(std::unique_ptr<RasterBucket> result) {
 void RasterTile::onError(std::exception_ptr err) {
     bucket.reset();
     loaded = true;
+    pending = false;
     renderable = false;
     observer->onTileError(*this, err);
 }
 
+void RasterTile::compact() {
+    // Cached tiles only keep the encoded image; the decoded pixels and the texture are
+    // recreated from it when the tile is revived.
+    if (data) {
+        bucket.reset();
+    }
+}
+
+void RasterTile::revive() {
+    if (bucket || !data) {
+        return;
+    }
+
+    // Fall back to parent or child tiles until the image has been decoded again.
+    renderable = false;
+    pending = true;
+    worker.invoke(&RasterTileWorker::parse, data);
+}
+
 void RasterTile::upload(gl::Context& context) {
     if (bucket) {
         bucket->upload(context);
@@ -75,4 +116,8 @@ void RasterTile::setNecessity(Necessity necessity) {
     loader.setNecessity(necessity);
 }
 
+void RasterTile::setPriority(int32_t priority) {
+    loader.setPriority(priority);
+}
+
 } // namespace mbgl
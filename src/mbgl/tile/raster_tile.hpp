@@ -19,10 +19,12 @@ class RasterTile : public Tile {
 public:
     RasterTile(const OverscaledTileID&,
                    const TileParameters&,
-                   const Tileset&);
+                   const Tileset&,
+                   uint16_t tileSize);
     ~RasterTile() final;
 
     void setNecessity(Necessity) final;
+    void setPriority(int32_t) final;
 
     void setError(std::exception_ptr);
     void setData(std::shared_ptr<const std::string> data,
@@ -36,6 +38,9 @@ public:
 
     void setMask(TileMask&&) override;
 
+    void compact() override;
+    void revive() override;
+
     void onParsed(std::unique_ptr<RasterBucket> result);
     void onError(std::exception_ptr);
 
@@ -45,6 +50,9 @@ private:
     std::shared_ptr<Mailbox> mailbox;
     Actor<RasterTileWorker> worker;
 
+    // The encoded image, kept so that the bucket can be dropped while the tile is cached.
+    std::shared_ptr<const std::string> data;
+
     // Contains the Bucket object for the tile. Buckets are render
     // objects and they get added by tile parsing operations.
     std::unique_ptr<RasterBucket> bucket;
@@ -2,12 +2,13 @@
 #include <mbgl/tile/raster_tile.hpp>
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/actor/actor.hpp>
-#include <mbgl/util/premultiply.hpp>
+#include <mbgl/util/image_decoder.hpp>
 
 namespace mbgl {
 
-RasterTileWorker::RasterTileWorker(ActorRef<RasterTileWorker>, ActorRef<RasterTile> parent_)
-    : parent(std::move(parent_)) {
+RasterTileWorker::RasterTileWorker(ActorRef<RasterTileWorker>, ActorRef<RasterTile> parent_, optional<Size> decodeSize_)
+    : parent(std::move(parent_)),
+      decodeSize(std::move(decodeSize_)) {
 }
 
 void RasterTileWorker::parse(std::shared_ptr<const std::string> data) {
@@ -17,7 +18,11 @@ void RasterTileWorker::parse(std::shared_ptr<const std::string> data) {
     }
 
     try {
-        auto bucket = std::make_unique<RasterBucket>(decodeImage(*data));
+        ImageDecodeOptions options;
+        options.pool = &ImageBufferPool::shared();
+        options.targetSize = decodeSize;
+
+        auto bucket = std::make_unique<RasterBucket>(decodeImage(*data, options));
         parent.invoke(&RasterTile::onParsed, std::move(bucket));
     } catch (...) {
         parent.invoke(&RasterTile::onError, std::current_exception());
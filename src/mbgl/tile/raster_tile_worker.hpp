@@ -1,6 +1,8 @@
 #pragma once
 
 #include <mbgl/actor/actor_ref.hpp>
+#include <mbgl/util/optional.hpp>
+#include <mbgl/util/size.hpp>
 
 #include <memory>
 #include <string>
@@ -11,12 +13,14 @@ class RasterTile;
 
 class RasterTileWorker {
 public:
-    RasterTileWorker(ActorRef<RasterTileWorker>, ActorRef<RasterTile>);
+    // Images larger than the decode size are scaled down while decoding, where supported.
+    RasterTileWorker(ActorRef<RasterTileWorker>, ActorRef<RasterTile>, optional<Size> decodeSize);
 
     void parse(std::shared_ptr<const std::string> data);
 
 private:
     ActorRef<RasterTile> parent;
+    const optional<Size> decodeSize;
 };
 
 } // namespace mbgl
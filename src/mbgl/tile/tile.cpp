@@ -29,15 +29,15 @@ void Tile::dumpDebugLogs() const {
     Log::Info(Event::General, "Tile::complete: %s", isComplete() ? "yes" : "no");
 }
 
-void Tile::queryRenderedFeatures(
-        std::unordered_map<std::string, std::vector<Feature>>&,
+bool Tile::queryRenderedFeatures(
+        const RenderedFeatureCallback&,
         const GeometryCoordinates&,
         const TransformState&,
         const RenderStyle&,
-        const RenderedQueryOptions&) {}
+        const RenderedQueryOptions&) {
+    return true;
+}
 
-void Tile::querySourceFeatures(
-        std::vector<Feature>&,
-        const SourceQueryOptions&) {}
+void Tile::querySourceFeatures(SourceFeatureQuery&) {}
 
 } // namespace mbgl
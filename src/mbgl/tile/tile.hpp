@@ -8,6 +8,7 @@
 #include <mbgl/tile/tile_id.hpp>
 #include <mbgl/renderer/tile_mask.hpp>
 #include <mbgl/renderer/bucket.hpp>
+#include <mbgl/renderer/query.hpp>
 #include <mbgl/tile/geometry_tile_data.hpp>
 #include <mbgl/storage/resource.hpp>
 #include <mbgl/style/layer_impl.hpp>
@@ -24,8 +25,7 @@ class TransformState;
 class TileObserver;
 class PlacementConfig;
 class RenderStyle;
-class RenderedQueryOptions;
-class SourceQueryOptions;
+class SourceFeatureQuery;
 
 namespace gl {
 class Context;
@@ -47,6 +47,10 @@ public:
 
     virtual void setNecessity(Necessity) = 0;
 
+    // Orders the tile's pending requests relative to those of other tiles with the same necessity;
+    // see Resource::priority.
+    virtual void setPriority(int32_t) {}
+
     // Mark this tile as no longer needed and cancel any pending work.
     virtual void cancel() = 0;
 
@@ -57,16 +61,24 @@ public:
     virtual void setLayers(const std::vector<Immutable<style::Layer::Impl>>&) {}
     virtual void setMask(TileMask&&) {}
 
-    virtual void queryRenderedFeatures(
-            std::unordered_map<std::string, std::vector<Feature>>& result,
+    // Called when the tile is moved into the TileCache. Tiles may release any data that
+    // can be recreated cheaply from what they retain.
+    virtual void compact() {}
+
+    // Called when a cached tile is taken out of the TileCache to be used again. Tiles must
+    // start recreating whatever they released in compact().
+    virtual void revive() {}
+
+    // Passes the features rendered within the query geometry to the callback. Returns false if the
+    // callback stopped the query.
+    virtual bool queryRenderedFeatures(
+            const RenderedFeatureCallback&,
             const GeometryCoordinates& queryGeometry,
             const TransformState&,
             const RenderStyle&,
             const RenderedQueryOptions& options);
 
-    virtual void querySourceFeatures(
-            std::vector<Feature>& result,
-            const SourceQueryOptions&);
+    virtual void querySourceFeatures(SourceFeatureQuery&);
 
     void setTriedOptional();
 
@@ -22,6 +22,8 @@ void TileCache::add(const OverscaledTileID& key, std::unique_ptr<Tile> tile) {
         return;
     }
 
+    tile->compact();
+
     // insert new or query existing tile
     if (tiles.emplace(key, std::move(tile)).second) {
         // remove existing tile key
@@ -33,7 +35,8 @@ void TileCache::add(const OverscaledTileID& key, std::unique_ptr<Tile> tile) {
 
     // purge oldest key/tile if necessary
     if (orderedKeys.size() > size) {
-        get(orderedKeys.front());
+        tiles.erase(orderedKeys.front());
+        orderedKeys.pop_front();
     }
 
     assert(orderedKeys.size() <= size);
@@ -49,6 +52,7 @@ std::unique_ptr<Tile> TileCache::get(const OverscaledTileID& key) {
         tiles.erase(it);
         orderedKeys.remove(key);
         assert(tile->isRenderable());
+        tile->revive();
     }
 
     return tile;
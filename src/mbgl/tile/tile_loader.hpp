@@ -34,6 +34,8 @@ public:
         }
     }
 
+    void setPriority(int32_t);
+
 private:
     // called when the tile is one of the ideal tiles that we want to show definitely. the tile source
     // should try to make every effort (e.g. fetch from internet, or revalidate existing resources).
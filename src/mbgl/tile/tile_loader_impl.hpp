@@ -87,6 +87,16 @@ void TileLoader<T>::makeOptional() {
     }
 }
 
+template <typename T>
+void TileLoader<T>::setPriority(int32_t priority) {
+    if (priority != resource.priority) {
+        resource.priority = priority;
+        if (request) {
+            request->setPriority(priority);
+        }
+    }
+}
+
 template <typename T>
 void TileLoader<T>::loadedData(const Response& res) {
     if (res.error && res.error->reason != Response::Error::Reason::NotFound) {
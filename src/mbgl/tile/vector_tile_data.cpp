@@ -1,5 +1,7 @@
 #include <mbgl/tile/vector_tile_data.hpp>
 #include <mbgl/util/constants.hpp>
+#include <mbgl/util/fnv_hash.hpp>
+#include <mbgl/util/string.hpp>
 
 namespace mbgl {
 
@@ -82,6 +84,11 @@ std::unique_ptr<GeometryTileLayer> VectorTileData::getLayer(const std::string& n
     return nullptr;
 }
 
+optional<std::string> VectorTileData::contentKey() const {
+    // The tile URL and ETag aren't known to the worker, so identify the data by its bytes instead.
+    return util::toString(data->size()) + ":" + util::toString(util::fnvHash(*data));
+}
+
 std::vector<std::string> VectorTileData::layerNames() const {
     return mapbox::vector_tile::buffer(*data).layerNames();
 }
@@ -42,6 +42,7 @@ public:
 
     std::unique_ptr<GeometryTileData> clone() const override;
     std::unique_ptr<GeometryTileLayer> getLayer(const std::string& name) const override;
+    optional<std::string> contentKey() const override;
 
     std::vector<std::string> layerNames() const;
 
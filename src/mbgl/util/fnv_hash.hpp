@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace mbgl {
+namespace util {
+
+// 64-bit FNV-1a hash. Unlike std::hash, the result is the same across runs, builds and platforms,
+// so it can be used to name data that is persisted on disk.
+inline uint64_t fnvHash(const char* data, std::size_t length, uint64_t hash = 14695981039346656037ull) {
+    for (std::size_t i = 0; i < length; i++) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+inline uint64_t fnvHash(const std::string& data) {
+    return fnvHash(data.data(), data.size());
+}
+
+} // namespace util
+} // namespace mbgl
@@ -0,0 +1,49 @@
+#include <mbgl/util/image_buffer_pool.hpp>
+
+namespace mbgl {
+
+ImageBufferPool::ImageBufferPool(std::size_t maximumBytes_)
+    : maximumBytes(maximumBytes_) {
+}
+
+std::unique_ptr<uint8_t[]> ImageBufferPool::acquire(std::size_t bytes) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = buffers.find(bytes);
+        if (it != buffers.end()) {
+            std::unique_ptr<uint8_t[]> buffer = std::move(it->second);
+            buffers.erase(it);
+            retainedBytes -= bytes;
+            return buffer;
+        }
+    }
+
+    return std::unique_ptr<uint8_t[]>(new uint8_t[bytes]);
+}
+
+void ImageBufferPool::recycle(std::unique_ptr<uint8_t[]> buffer, std::size_t bytes) {
+    if (!buffer || !bytes) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (retainedBytes + bytes > maximumBytes) {
+        return;
+    }
+
+    buffers.emplace(bytes, std::move(buffer));
+    retainedBytes += bytes;
+}
+
+std::size_t ImageBufferPool::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return retainedBytes;
+}
+
+ImageBufferPool& ImageBufferPool::shared() {
+    // Enough for 32 256×256 or 8 512×512 tiles.
+    static ImageBufferPool pool { 8 * 1024 * 1024 };
+    return pool;
+}
+
+} // namespace mbgl
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <mbgl/util/noncopyable.hpp>
+#include <mbgl/util/image.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace mbgl {
+
+// A thread-safe pool of pixel buffers. Decoders obtain their destination buffers from it, and
+// buffers of images that are no longer needed (e.g. after a texture upload) are handed back so
+// that the next image of the same size doesn't have to allocate. Buffers are pooled by their
+// exact byte size, which works well since most images are tiles of one or two sizes.
+class ImageBufferPool : private util::noncopyable {
+public:
+    ImageBufferPool(std::size_t maximumBytes);
+
+    // Returns an uninitialized buffer of `bytes` bytes, reusing a pooled one if available.
+    std::unique_ptr<uint8_t[]> acquire(std::size_t bytes);
+
+    // Returns a buffer to the pool. It is freed instead if the pool is full.
+    void recycle(std::unique_ptr<uint8_t[]>, std::size_t bytes);
+
+    template <ImageAlphaMode Mode>
+    void recycle(Image<Mode>&& image) {
+        const std::size_t bytes = image.bytes();
+        image.size = { 0, 0 };
+        recycle(std::move(image.data), bytes);
+    }
+
+    // Total number of bytes currently held by the pool.
+    std::size_t size() const;
+
+    // Pool shared by raster tile decoding and raster bucket uploads.
+    static ImageBufferPool& shared();
+
+private:
+    const std::size_t maximumBytes;
+
+    mutable std::mutex mutex;
+    std::unordered_multimap<std::size_t, std::unique_ptr<uint8_t[]>> buffers;
+    std::size_t retainedBytes = 0;
+};
+
+} // namespace mbgl
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <mbgl/util/image.hpp>
+#include <mbgl/util/image_buffer_pool.hpp>
+#include <mbgl/util/optional.hpp>
+
+#include <string>
+
+namespace mbgl {
+
+class ImageDecodeOptions {
+public:
+    // When set, destination buffers are obtained from this pool instead of being allocated.
+    ImageBufferPool* pool = nullptr;
+
+    // The size the image is going to be displayed at. Decoders that support scaled decoding
+    // (JPEG DCT scaling, WebP) produce the smallest image that still covers this size.
+    optional<Size> targetSize;
+
+    // Returns an image with uninitialized pixels, backed by a pooled buffer if possible.
+    PremultipliedImage allocate(Size size) const {
+        const std::size_t bytes = PremultipliedImage::channels * size.width * size.height;
+        return { size, pool ? pool->acquire(bytes) : std::unique_ptr<uint8_t[]>(new uint8_t[bytes]) };
+    }
+};
+
+// Decodes a PNG, JPEG or WebP image straight into its final, premultiplied buffer. Platforms
+// that rely on system decoders may ignore the options.
+PremultipliedImage decodeImage(const std::string&, const ImageDecodeOptions&);
+
+} // namespace mbgl
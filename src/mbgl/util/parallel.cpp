@@ -0,0 +1,66 @@
+#include <mbgl/util/parallel.hpp>
+#include <mbgl/actor/mailbox.hpp>
+#include <mbgl/actor/message.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace mbgl {
+namespace util {
+
+namespace {
+
+// Upper bound on the number of scheduler threads asked to help with a single call.
+const std::size_t maximumHelpers = 3;
+
+class ParallelFor {
+public:
+    ParallelFor(std::size_t count_, const std::function<void (std::size_t)>& fn_)
+        : count(count_), fn(fn_) {
+    }
+
+    void run() {
+        for (std::size_t i = next++; i < count; i = next++) {
+            fn(i);
+        }
+    }
+
+private:
+    const std::size_t count;
+    const std::function<void (std::size_t)>& fn;
+    std::atomic<std::size_t> next { 0 };
+};
+
+} // namespace
+
+void parallelFor(Scheduler& scheduler, std::size_t count, const std::function<void (std::size_t)>& fn) {
+    if (count == 0) {
+        return;
+    } else if (count == 1) {
+        fn(0);
+        return;
+    }
+
+    ParallelFor work(count, fn);
+
+    const std::size_t helperCount = std::min(count - 1, maximumHelpers);
+    std::vector<std::shared_ptr<Mailbox>> helpers;
+    helpers.reserve(helperCount);
+    for (std::size_t i = 0; i < helperCount; ++i) {
+        helpers.push_back(std::make_shared<Mailbox>(scheduler));
+        helpers.back()->push(actor::makeMessage(work, &ParallelFor::run));
+    }
+
+    work.run();
+
+    // Closing a mailbox blocks until a helper that is running has finished, and keeps helpers that
+    // haven't started yet from ever touching `work`.
+    for (auto& helper : helpers) {
+        helper->close();
+    }
+}
+
+} // namespace util
+} // namespace mbgl
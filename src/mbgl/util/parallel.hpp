@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace mbgl {
+
+class Scheduler;
+
+namespace util {
+
+// Calls fn(i) for every i in [0, count), spreading the calls over the calling thread and the
+// scheduler's threads. Returns once every call has completed. The calling thread takes part in the
+// work, so this makes progress even if the scheduler is busy or runs on the calling thread.
+void parallelFor(Scheduler&, std::size_t count, const std::function<void (std::size_t)>& fn);
+
+} // namespace util
+} // namespace mbgl
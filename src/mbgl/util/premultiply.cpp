@@ -12,8 +12,13 @@ PremultipliedImage premultiply(UnassociatedImage&& src) {
     src.size = { 0, 0 };
     dst.data = std::move(src.data);
 
-    uint8_t* data = dst.data.get();
-    for (size_t i = 0; i < dst.bytes(); i += 4) {
+    premultiply(dst.data.get(), dst.bytes());
+
+    return dst;
+}
+
+void premultiply(uint8_t* data, std::size_t bytes) {
+    for (size_t i = 0; i < bytes; i += 4) {
         uint8_t& r = data[i + 0];
         uint8_t& g = data[i + 1];
         uint8_t& b = data[i + 2];
@@ -22,8 +27,6 @@ PremultipliedImage premultiply(UnassociatedImage&& src) {
         g = (g * a + 127) / 255;
         b = (b * a + 127) / 255;
     }
-
-    return dst;
 }
 
 UnassociatedImage unpremultiply(PremultipliedImage&& src) {
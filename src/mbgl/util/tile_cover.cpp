@@ -1,9 +1,12 @@
 #include <mbgl/util/tile_cover.hpp>
 #include <mbgl/util/constants.hpp>
 #include <mbgl/util/interpolate.hpp>
+#include <mbgl/util/projection.hpp>
+#include <mbgl/util/mat4.hpp>
 #include <mbgl/map/transform_state.hpp>
 
 #include <functional>
+#include <map>
 
 namespace mbgl {
 
@@ -169,5 +172,76 @@ std::vector<UnwrappedTileID> tileCover(const TransformState& state, int32_t z) {
         z);
 }
 
+std::vector<UnwrappedTileID> tileCoverWithLOD(const TransformState& state, int32_t z, int32_t minZ) {
+    std::vector<UnwrappedTileID> cover = tileCover(state, z);
+    if (state.getPitch() == 0 || z <= minZ) {
+        return cover;
+    }
+
+    mat4 projMatrix;
+    state.getProjMatrix(projMatrix);
+    const double worldSize = Projection::worldSize(state.zoomScale(state.getZoom()));
+    const double centerDistance = state.getCameraToCenterDistance();
+
+    // For every tile of the cover and all of its ancestors down to minZ, stores the highest zoom
+    // level that any of the covered tiles below it wants to be rendered at.
+    std::map<UnwrappedTileID, int32_t> targetZooms;
+    for (const auto& tileID : cover) {
+        const double tileScale = 1ull << z;
+        const double x = (tileID.canonical.x + tileID.wrap * tileScale + 0.5) * worldSize / tileScale;
+        const double y = (tileID.canonical.y + 0.5) * worldSize / tileScale;
+
+        // The w component of the projected tile center is its distance from the camera. A tile
+        // that is twice as far away as the map center is drawn at half the size, so it is replaced
+        // with a tile one zoom level lower.
+        const double distance = projMatrix[3] * x + projMatrix[7] * y + projMatrix[15];
+        int32_t targetZoom = z;
+        if (distance > centerDistance) {
+            targetZoom = std::max(minZ, z - int32_t(std::floor(std::log2(distance / centerDistance))));
+        }
+
+        for (int32_t n = z; n >= minZ; --n) {
+            auto it = targetZooms.emplace(UnwrappedTileID(tileID.wrap, tileID.canonical.scaledTo(n)), targetZoom).first;
+            it->second = std::max(it->second, targetZoom);
+        }
+    }
+
+    const auto c = TileCoordinate::fromScreenCoordinate(
+        state, z, { state.getSize().width / 2.0, state.getSize().height / 2.0 }).p;
+
+    // Descend from minZ and pick the first tile that is detailed enough for all covered tiles
+    // below it. The result is a set of non-overlapping tiles of mixed zoom levels, sorted by the
+    // distance to the map center in tile coordinates of zoom level z, like tileCover().
+    std::multimap<double, UnwrappedTileID> sorted;
+    std::function<void(const UnwrappedTileID&, int32_t)> visit = [&](const UnwrappedTileID& tileID, int32_t targetZoom) {
+        if (targetZoom <= tileID.canonical.z) {
+            const double scale = 1ull << (z - tileID.canonical.z);
+            const double dx = (tileID.canonical.x + tileID.wrap * double(1ull << tileID.canonical.z) + 0.5) * scale - c.x;
+            const double dy = (tileID.canonical.y + 0.5) * scale - c.y;
+            sorted.emplace(dx * dx + dy * dy, tileID);
+            return;
+        }
+        for (const auto& childID : tileID.children()) {
+            auto it = targetZooms.find(childID);
+            if (it != targetZooms.end()) {
+                visit(childID, it->second);
+            }
+        }
+    };
+
+    for (const auto& entry : targetZooms) {
+        if (entry.first.canonical.z == minZ) {
+            visit(entry.first, entry.second);
+        }
+    }
+
+    std::vector<UnwrappedTileID> result;
+    result.reserve(sorted.size());
+    for (const auto& entry : sorted) {
+        result.push_back(entry.second);
+    }
+    return result;
+}
+
 } // namespace util
 } // namespace mbgl
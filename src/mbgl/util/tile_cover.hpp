@@ -18,5 +18,9 @@ int32_t coveringZoomLevel(double z, SourceType type, uint16_t tileSize);
 std::vector<UnwrappedTileID> tileCover(const TransformState&, int32_t z);
 std::vector<UnwrappedTileID> tileCover(const LatLngBounds&, int32_t z);
 
+// Like tileCover(), but tiles that are far away from the camera in pitched views are replaced by
+// tiles of a lower zoom level, down to minZ. The returned tiles don't overlap.
+std::vector<UnwrappedTileID> tileCoverWithLOD(const TransformState&, int32_t z, int32_t minZ);
+
 } // namespace util
 } // namespace mbgl
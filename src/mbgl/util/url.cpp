@@ -101,6 +101,12 @@ URL::URL(const std::string& str)
       }()) {
 }
 
+std::string origin(const std::string& str) {
+    const URL url(str);
+    return str.substr(url.scheme.first, url.scheme.second) + "://" +
+           str.substr(url.domain.first, url.domain.second);
+}
+
 Path::Path(const std::string& str, const size_t pos, const size_t count)
     : directory([&]() -> Segment {
           // Finds the string between pos and the first /, if it exists
@@ -22,6 +22,10 @@ public:
     URL(const std::string&);
 };
 
+// Returns the scheme and domain of the URL, including the port if there is one, e.g.
+// "https://example.com:8080" for "https://example.com:8080/foo/bar.png?a=b".
+std::string origin(const std::string& url);
+
 // Class that holds position + lenth pairs for directory, extension, and filename of a path.
 // The extension will contain the preceding ., and optionally a preceding @2x specifier.
 // The filename will not contain the file extension.
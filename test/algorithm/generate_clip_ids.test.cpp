@@ -37,6 +37,7 @@ TEST(GenerateClipIDs, ParentAndFourChildren) {
 
     algorithm::ClipIDGenerator generator;
     generator.update<Renderable>({ renderables.begin(), renderables.end() });
+    EXPECT_TRUE(generator.hasOverlappingTiles());
 
     EXPECT_EQ(decltype(renderables)({
                   Renderable{ UnwrappedTileID{ 0, 0, 0 }, ClipID{ "00000111", "00000001" } },
@@ -136,6 +137,7 @@ TEST(GenerateClipIDs, SevenOnSameLevel) {
 
     algorithm::ClipIDGenerator generator;
     generator.update<Renderable>({ renderables.begin(), renderables.end() });
+    EXPECT_FALSE(generator.hasOverlappingTiles());
     EXPECT_EQ(decltype(renderables)({
                   Renderable{ UnwrappedTileID{ 2, 0, 0 }, ClipID{ "00000111", "00000001" } },
                   Renderable{ UnwrappedTileID{ 2, 0, 1 }, ClipID{ "00000111", "00000010" } },
@@ -404,3 +406,78 @@ TEST(GenerateClipIDs, SecondSourceHasParentOfFirstSource) {
               }),
               clipIDs);
 }
+
+TEST(GenerateClipIDs, OverlappingTiles) {
+    std::vector<Renderable> renderables1{
+        Renderable{ UnwrappedTileID{ 1, 0, 0 }, {} },
+        Renderable{ UnwrappedTileID{ 1, 1, 0 }, {} },
+    };
+    std::vector<Renderable> renderables2{
+        Renderable{ UnwrappedTileID{ 0, 0, 0 }, {} },
+    };
+    std::vector<Renderable> renderables3{
+        Renderable{ UnwrappedTileID{ 0, 0, 0 }, {} },
+        Renderable{ UnwrappedTileID{ 1, 0, 1 }, {} },
+    };
+
+    algorithm::ClipIDGenerator generator;
+    generator.update<Renderable>({ renderables1.begin(), renderables1.end() });
+    generator.update<Renderable>({ renderables2.begin(), renderables2.end() });
+
+    // Tiles of different sources are never drawn with the same layer, so they don't overlap.
+    EXPECT_FALSE(generator.hasOverlappingTiles());
+
+    generator.update<Renderable>({ renderables3.begin(), renderables3.end() });
+    EXPECT_TRUE(generator.hasOverlappingTiles());
+}
+
+TEST(GenerateClipIDs, MixedZoomLevels) {
+    // Render tiles of a level-of-detail cover: distant tiles at zoom level 1, close ones at zoom
+    // level 2, and a parent tile standing in for the missing ideal tile 2/0/2.
+    std::vector<Renderable> renderables{
+        Renderable{ UnwrappedTileID{ 1, 0, 0 }, {} },
+        Renderable{ UnwrappedTileID{ 1, 0, 1 }, {} },
+        Renderable{ UnwrappedTileID{ 1, 1, 0 }, {} },
+        Renderable{ UnwrappedTileID{ 2, 0, 3 }, {} },
+        Renderable{ UnwrappedTileID{ 2, 1, 2 }, {} },
+        Renderable{ UnwrappedTileID{ 2, 1, 3 }, {} },
+        Renderable{ UnwrappedTileID{ 2, 2, 2 }, {} },
+        Renderable{ UnwrappedTileID{ 2, 2, 3 }, {} },
+        Renderable{ UnwrappedTileID{ 2, 3, 2 }, {} },
+        Renderable{ UnwrappedTileID{ 2, 3, 3 }, {} },
+    };
+
+    algorithm::ClipIDGenerator generator;
+    generator.update<Renderable>({ renderables.begin(), renderables.end() });
+    EXPECT_TRUE(generator.hasOverlappingTiles());
+
+    EXPECT_EQ(decltype(renderables)({
+                  Renderable{ UnwrappedTileID{ 1, 0, 0 }, ClipID{ "00001111", "00000001" } },
+                  Renderable{ UnwrappedTileID{ 1, 0, 1 }, ClipID{ "00001111", "00000010" } },
+                  Renderable{ UnwrappedTileID{ 1, 1, 0 }, ClipID{ "00001111", "00000011" } },
+                  Renderable{ UnwrappedTileID{ 2, 0, 3 }, ClipID{ "00001111", "00000100" } },
+                  Renderable{ UnwrappedTileID{ 2, 1, 2 }, ClipID{ "00001111", "00000101" } },
+                  Renderable{ UnwrappedTileID{ 2, 1, 3 }, ClipID{ "00001111", "00000110" } },
+                  Renderable{ UnwrappedTileID{ 2, 2, 2 }, ClipID{ "00001111", "00000111" } },
+                  Renderable{ UnwrappedTileID{ 2, 2, 3 }, ClipID{ "00001111", "00001000" } },
+                  Renderable{ UnwrappedTileID{ 2, 3, 2 }, ClipID{ "00001111", "00001001" } },
+                  Renderable{ UnwrappedTileID{ 2, 3, 3 }, ClipID{ "00001111", "00001010" } },
+              }),
+              renderables);
+
+    // The parent tile isn't entirely covered by its children, so it keeps its clip ID.
+    const auto clipIDs = generator.getClipIDs();
+    EXPECT_EQ(decltype(clipIDs)({
+                  { UnwrappedTileID{ 1, 0, 0 }, ClipID{ "00001111", "00000001" } },
+                  { UnwrappedTileID{ 1, 0, 1 }, ClipID{ "00001111", "00000010" } },
+                  { UnwrappedTileID{ 1, 1, 0 }, ClipID{ "00001111", "00000011" } },
+                  { UnwrappedTileID{ 2, 0, 3 }, ClipID{ "00001111", "00000100" } },
+                  { UnwrappedTileID{ 2, 1, 2 }, ClipID{ "00001111", "00000101" } },
+                  { UnwrappedTileID{ 2, 1, 3 }, ClipID{ "00001111", "00000110" } },
+                  { UnwrappedTileID{ 2, 2, 2 }, ClipID{ "00001111", "00000111" } },
+                  { UnwrappedTileID{ 2, 2, 3 }, ClipID{ "00001111", "00001000" } },
+                  { UnwrappedTileID{ 2, 3, 2 }, ClipID{ "00001111", "00001001" } },
+                  { UnwrappedTileID{ 2, 3, 3 }, ClipID{ "00001111", "00001010" } },
+              }),
+              clipIDs);
+}
@@ -1259,3 +1259,176 @@ TEST(UpdateRenderables, LoadRequiredIfIdealTileCantBeFound) {
               }),
               log);
 }
+
+TEST(UpdateRenderables, MixedZoomIdealTiles) {
+    ActionLog log;
+    MockSource source;
+    auto getTileData = getTileDataFn(log, source.dataTiles);
+    auto createTileData = createTileDataFn(log, source.dataTiles);
+    auto retainTileData = retainTileDataFn(log);
+    auto renderTile = renderTileFn(log);
+
+    // A level-of-detail cover where a distant area is covered by a tile of a lower zoom level.
+    source.idealTiles.emplace(UnwrappedTileID{ 1, 0, 0 });
+    source.idealTiles.emplace(UnwrappedTileID{ 2, 2, 2 });
+
+    // Each ideal tile is loaded at its own zoom level.
+    algorithm::updateRenderables(getTileData, createTileData, retainTileData, renderTile,
+                                 source.idealTiles, source.zoomRange, 2);
+    EXPECT_EQ(ActionLog({
+                  GetTileDataAction{ { 1, 0, { 1, 0, 0 } }, NotFound },    // lower zoom ideal tile
+                  CreateTileDataAction{ { 1, 0, { 1, 0, 0 } } },           //
+                  RetainTileDataAction{ { 1, 0, { 1, 0, 0 } }, Resource::Necessity::Required }, //
+                  GetTileDataAction{ { 2, 0, { 2, 0, 0 } }, NotFound },    // four child tiles
+                  GetTileDataAction{ { 2, 0, { 2, 0, 1 } }, NotFound },    // ...
+                  GetTileDataAction{ { 2, 0, { 2, 1, 0 } }, NotFound },    // ...
+                  GetTileDataAction{ { 2, 0, { 2, 1, 1 } }, NotFound },    // ...
+                  GetTileDataAction{ { 0, 0, { 0, 0, 0 } }, NotFound },    // parent tile
+
+                  GetTileDataAction{ { 2, 0, { 2, 2, 2 } }, NotFound },    // higher zoom ideal tile
+                  CreateTileDataAction{ { 2, 0, { 2, 2, 2 } } },           //
+                  RetainTileDataAction{ { 2, 0, { 2, 2, 2 } }, Resource::Necessity::Required }, //
+                  GetTileDataAction{ { 3, 0, { 3, 4, 4 } }, NotFound },    // four child tiles
+                  GetTileDataAction{ { 3, 0, { 3, 4, 5 } }, NotFound },    // ...
+                  GetTileDataAction{ { 3, 0, { 3, 5, 4 } }, NotFound },    // ...
+                  GetTileDataAction{ { 3, 0, { 3, 5, 5 } }, NotFound },    // ...
+                  GetTileDataAction{ { 1, 0, { 1, 1, 1 } }, NotFound },    // parent tile
+                  // 0/0/0 was already checked for the lower zoom ideal tile.
+              }),
+              log);
+
+    // The lower zoom ideal tile falls back to its children, the higher zoom one to its parent.
+    log.clear();
+    auto tile_2_2_0_0 = source.createTileData(OverscaledTileID{ 2, 0, { 2, 0, 0 } });
+    tile_2_2_0_0->renderable = true;
+    auto tile_2_2_0_1 = source.createTileData(OverscaledTileID{ 2, 0, { 2, 0, 1 } });
+    tile_2_2_0_1->renderable = true;
+    auto tile_2_2_1_0 = source.createTileData(OverscaledTileID{ 2, 0, { 2, 1, 0 } });
+    tile_2_2_1_0->renderable = true;
+    auto tile_2_2_1_1 = source.createTileData(OverscaledTileID{ 2, 0, { 2, 1, 1 } });
+    tile_2_2_1_1->renderable = true;
+    auto tile_1_1_1_1 = source.createTileData(OverscaledTileID{ 1, 0, { 1, 1, 1 } });
+    tile_1_1_1_1->renderable = true;
+    algorithm::updateRenderables(getTileData, createTileData, retainTileData, renderTile,
+                                 source.idealTiles, source.zoomRange, 2);
+    EXPECT_EQ(ActionLog({
+                  GetTileDataAction{ { 1, 0, { 1, 0, 0 } }, Found },       // lower zoom ideal tile
+                  RetainTileDataAction{ { 1, 0, { 1, 0, 0 } }, Resource::Necessity::Required }, //
+                  GetTileDataAction{ { 2, 0, { 2, 0, 0 } }, Found },       // four child tiles
+                  RetainTileDataAction{ { 2, 0, { 2, 0, 0 } }, Resource::Necessity::Optional }, //
+                  RenderTileAction{ { 2, 0, 0 }, *tile_2_2_0_0 },          //
+                  GetTileDataAction{ { 2, 0, { 2, 0, 1 } }, Found },       // ...
+                  RetainTileDataAction{ { 2, 0, { 2, 0, 1 } }, Resource::Necessity::Optional }, //
+                  RenderTileAction{ { 2, 0, 1 }, *tile_2_2_0_1 },          //
+                  GetTileDataAction{ { 2, 0, { 2, 1, 0 } }, Found },       // ...
+                  RetainTileDataAction{ { 2, 0, { 2, 1, 0 } }, Resource::Necessity::Optional }, //
+                  RenderTileAction{ { 2, 1, 0 }, *tile_2_2_1_0 },          //
+                  GetTileDataAction{ { 2, 0, { 2, 1, 1 } }, Found },       // ...
+                  RetainTileDataAction{ { 2, 0, { 2, 1, 1 } }, Resource::Necessity::Optional }, //
+                  RenderTileAction{ { 2, 1, 1 }, *tile_2_2_1_1 },          //
+
+                  GetTileDataAction{ { 2, 0, { 2, 2, 2 } }, Found },       // higher zoom ideal tile
+                  RetainTileDataAction{ { 2, 0, { 2, 2, 2 } }, Resource::Necessity::Required }, //
+                  GetTileDataAction{ { 3, 0, { 3, 4, 4 } }, NotFound },    // four child tiles
+                  GetTileDataAction{ { 3, 0, { 3, 4, 5 } }, NotFound },    // ...
+                  GetTileDataAction{ { 3, 0, { 3, 5, 4 } }, NotFound },    // ...
+                  GetTileDataAction{ { 3, 0, { 3, 5, 5 } }, NotFound },    // ...
+                  GetTileDataAction{ { 1, 0, { 1, 1, 1 } }, Found },       // parent tile
+                  RetainTileDataAction{ { 1, 0, { 1, 1, 1 } }, Resource::Necessity::Optional }, //
+                  RenderTileAction{ { 1, 1, 1 }, *tile_1_1_1_1 },          //
+              }),
+              log);
+
+    // Once loaded, both ideal tiles are rendered at their own zoom levels.
+    log.clear();
+    auto tile_1_1_0_0 = source.dataTiles[{ 1, 0, { 1, 0, 0 } }].get();
+    tile_1_1_0_0->renderable = true;
+    auto tile_2_2_2_2 = source.dataTiles[{ 2, 0, { 2, 2, 2 } }].get();
+    tile_2_2_2_2->renderable = true;
+    algorithm::updateRenderables(getTileData, createTileData, retainTileData, renderTile,
+                                 source.idealTiles, source.zoomRange, 2);
+    EXPECT_EQ(ActionLog({
+                  GetTileDataAction{ { 1, 0, { 1, 0, 0 } }, Found },       //
+                  RetainTileDataAction{ { 1, 0, { 1, 0, 0 } }, Resource::Necessity::Required }, //
+                  RenderTileAction{ { 1, 0, 0 }, *tile_1_1_0_0 },          //
+                  GetTileDataAction{ { 2, 0, { 2, 2, 2 } }, Found },       //
+                  RetainTileDataAction{ { 2, 0, { 2, 2, 2 } }, Resource::Necessity::Required }, //
+                  RenderTileAction{ { 2, 2, 2 }, *tile_2_2_2_2 },          //
+              }),
+              log);
+}
+
+TEST(UpdateRenderables, MixedZoomOverscaledIdealTiles) {
+    ActionLog log;
+    MockSource source;
+    auto getTileData = getTileDataFn(log, source.dataTiles);
+    auto createTileData = createTileDataFn(log, source.dataTiles);
+    auto retainTileData = retainTileDataFn(log);
+    auto renderTile = renderTileFn(log);
+
+    source.zoomRange.max = 2;
+    source.idealTiles.emplace(UnwrappedTileID{ 1, 0, 0 });
+    source.idealTiles.emplace(UnwrappedTileID{ 2, 2, 2 });
+
+    // Rendering at zoom level 3 overscales the most detailed tiles by one level. The lower zoom
+    // ideal tile is overscaled by the same amount.
+    algorithm::updateRenderables(getTileData, createTileData, retainTileData, renderTile,
+                                 source.idealTiles, source.zoomRange, 3);
+    EXPECT_EQ(ActionLog({
+                  GetTileDataAction{ { 2, 0, { 1, 0, 0 } }, NotFound },    // lower zoom ideal tile
+                  CreateTileDataAction{ { 2, 0, { 1, 0, 0 } } },           //
+                  RetainTileDataAction{ { 2, 0, { 1, 0, 0 } }, Resource::Necessity::Required }, //
+                  GetTileDataAction{ { 3, 0, { 1, 0, 0 } }, NotFound },    // overzoomed child
+                  GetTileDataAction{ { 1, 0, { 1, 0, 0 } }, NotFound },    // ascent
+                  GetTileDataAction{ { 0, 0, { 0, 0, 0 } }, NotFound },    // ...
+
+                  GetTileDataAction{ { 3, 0, { 2, 2, 2 } }, NotFound },    // higher zoom ideal tile
+                  CreateTileDataAction{ { 3, 0, { 2, 2, 2 } } },           //
+                  RetainTileDataAction{ { 3, 0, { 2, 2, 2 } }, Resource::Necessity::Required }, //
+                  GetTileDataAction{ { 4, 0, { 2, 2, 2 } }, NotFound },    // overzoomed child
+                  GetTileDataAction{ { 2, 0, { 2, 2, 2 } }, NotFound },    // ascent
+                  GetTileDataAction{ { 1, 0, { 1, 1, 1 } }, NotFound },    // ...
+              }),
+              log);
+
+    // A non-overscaled version of the lower zoom ideal tile is used until the overscaled one loads.
+    log.clear();
+    auto tile_1_1_0_0 = source.createTileData(OverscaledTileID{ 1, 0, { 1, 0, 0 } });
+    tile_1_1_0_0->renderable = true;
+    algorithm::updateRenderables(getTileData, createTileData, retainTileData, renderTile,
+                                 source.idealTiles, source.zoomRange, 3);
+    EXPECT_EQ(ActionLog({
+                  GetTileDataAction{ { 2, 0, { 1, 0, 0 } }, Found },       // lower zoom ideal tile
+                  RetainTileDataAction{ { 2, 0, { 1, 0, 0 } }, Resource::Necessity::Required }, //
+                  GetTileDataAction{ { 3, 0, { 1, 0, 0 } }, NotFound },    // overzoomed child
+                  GetTileDataAction{ { 1, 0, { 1, 0, 0 } }, Found },       // non-overscaled tile
+                  RetainTileDataAction{ { 1, 0, { 1, 0, 0 } }, Resource::Necessity::Optional }, //
+                  RenderTileAction{ { 1, 0, 0 }, *tile_1_1_0_0 },          //
+
+                  GetTileDataAction{ { 3, 0, { 2, 2, 2 } }, Found },       // higher zoom ideal tile
+                  RetainTileDataAction{ { 3, 0, { 2, 2, 2 } }, Resource::Necessity::Required }, //
+                  GetTileDataAction{ { 4, 0, { 2, 2, 2 } }, NotFound },    // overzoomed child
+                  GetTileDataAction{ { 2, 0, { 2, 2, 2 } }, NotFound },    // ascent
+                  GetTileDataAction{ { 1, 0, { 1, 1, 1 } }, NotFound },    // ...
+                  GetTileDataAction{ { 0, 0, { 0, 0, 0 } }, NotFound },    // ...
+              }),
+              log);
+
+    // Once loaded, the overscaled ideal tiles are rendered.
+    log.clear();
+    auto tile_2_1_0_0 = source.dataTiles[{ 2, 0, { 1, 0, 0 } }].get();
+    tile_2_1_0_0->renderable = true;
+    auto tile_3_2_2_2 = source.dataTiles[{ 3, 0, { 2, 2, 2 } }].get();
+    tile_3_2_2_2->renderable = true;
+    algorithm::updateRenderables(getTileData, createTileData, retainTileData, renderTile,
+                                 source.idealTiles, source.zoomRange, 3);
+    EXPECT_EQ(ActionLog({
+                  GetTileDataAction{ { 2, 0, { 1, 0, 0 } }, Found },       //
+                  RetainTileDataAction{ { 2, 0, { 1, 0, 0 } }, Resource::Necessity::Required }, //
+                  RenderTileAction{ { 1, 0, 0 }, *tile_2_1_0_0 },          //
+                  GetTileDataAction{ { 3, 0, { 2, 2, 2 } }, Found },       //
+                  RetainTileDataAction{ { 3, 0, { 2, 2, 2 } }, Resource::Necessity::Required }, //
+                  RenderTileAction{ { 2, 2, 2 }, *tile_3_2_2_2 },          //
+              }),
+              log);
+}
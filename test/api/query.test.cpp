@@ -83,6 +83,47 @@ TEST(Query, QueryRenderedFeaturesFilter) {
     EXPECT_EQ(features3.size(), 1u);
 }
 
+TEST(Query, QueryRenderedFeaturesStreaming) {
+    QueryTest test;
+
+    auto zz = test.map.pixelForLatLng({ 0, 0 });
+
+    std::vector<std::string> layerIDs;
+    test.frontend.getRenderer()->queryRenderedFeatures(zz, {}, [&] (const std::string& layerID, Feature&&) {
+        layerIDs.push_back(layerID);
+        return true;
+    });
+    EXPECT_EQ(layerIDs.size(), 4u);
+
+    std::size_t count = 0;
+    test.frontend.getRenderer()->queryRenderedFeatures(zz, {}, [&] (const std::string&, Feature&&) {
+        count++;
+        return false;
+    });
+    EXPECT_EQ(count, 1u);
+}
+
+TEST(Query, QueryRenderedFeaturesProperties) {
+    QueryTest test;
+
+    auto zz = test.map.pixelForLatLng({ 0, 0 });
+
+    RenderedQueryOptions options {{{ "layer4" }}, {}};
+    options.properties = {{ "key1", "key5" }};
+    auto features1 = test.frontend.getRenderer()->queryRenderedFeatures(zz, options);
+    ASSERT_EQ(features1.size(), 1u);
+    EXPECT_EQ(features1[0].properties.size(), 1u);
+    EXPECT_EQ(features1[0].properties.at("key1"), Value(std::string("value1")));
+    EXPECT_EQ(features1[0].id, optional<FeatureIdentifier>(std::string("feature1")));
+
+    options.properties = std::vector<std::string>();
+    options.geometry = false;
+    auto features2 = test.frontend.getRenderer()->queryRenderedFeatures(zz, options);
+    ASSERT_EQ(features2.size(), 1u);
+    EXPECT_TRUE(features2[0].properties.empty());
+    EXPECT_EQ(features2[0].id, optional<FeatureIdentifier>(std::string("feature1")));
+}
+
 TEST(Query, QuerySourceFeatures) {
     QueryTest test;
 
@@ -122,3 +163,20 @@ TEST(Query, QuerySourceFeaturesFilter) {
     EXPECT_EQ(features3.size(), 1u);
 }
 
+TEST(Query, QuerySourceFeaturesBoundsAndLimit) {
+    QueryTest test;
+
+    SourceQueryOptions options;
+    options.bounds = LatLngBounds::hull({ -1, -1 }, { 1, 1 });
+    auto features1 = test.frontend.getRenderer()->querySourceFeatures("source4", options);
+    EXPECT_EQ(features1.size(), 1u);
+
+    options.bounds = LatLngBounds::hull({ 10, 10 }, { 20, 20 });
+    auto features2 = test.frontend.getRenderer()->querySourceFeatures("source4", options);
+    EXPECT_EQ(features2.size(), 0u);
+
+    options.bounds = {};
+    options.limit = 0;
+    auto features3 = test.frontend.getRenderer()->querySourceFeatures("source4", options);
+    EXPECT_EQ(features3.size(), 0u);
+}
@@ -0,0 +1,56 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/geometry/polygon_tessellator.hpp>
+
+using namespace mbgl;
+
+TEST(PolygonTessellator, Convex) {
+    EXPECT_TRUE(isConvex({ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } }));
+    EXPECT_TRUE(isConvex({ { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 }, { 0, 0 } }));
+    EXPECT_TRUE(isConvex({ { 0, 0 }, { 0, 10 }, { 10, 10 }, { 10, 0 }, { 0, 0 } }));
+    EXPECT_TRUE(isConvex({ { 0, 0 }, { 10, 0 }, { 5, 8 } }));
+
+    // Collinear and repeated points don't affect convexity.
+    EXPECT_TRUE(isConvex({ { 0, 0 }, { 5, 0 }, { 10, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } }));
+}
+
+TEST(PolygonTessellator, NotConvex) {
+    // Too few points.
+    EXPECT_FALSE(isConvex({}));
+    EXPECT_FALSE(isConvex({ { 0, 0 }, { 10, 0 }, { 0, 0 } }));
+
+    // All points on a line.
+    EXPECT_FALSE(isConvex({ { 0, 0 }, { 5, 0 }, { 10, 0 } }));
+
+    // Concave.
+    EXPECT_FALSE(isConvex({ { 0, 0 }, { 10, 0 }, { 5, 5 }, { 10, 10 }, { 0, 10 } }));
+
+    // A spike that doubles back along the same line.
+    EXPECT_FALSE(isConvex({ { 0, 0 }, { 10, 0 }, { 20, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 } }));
+
+    // Pentagram: every vertex turns the same way, but the ring winds around twice.
+    EXPECT_FALSE(isConvex({ { 0, 10 }, { 6, -8 }, { -10, 3 }, { 10, 3 }, { -6, -8 } }));
+}
+
+TEST(PolygonTessellator, ConvexFan) {
+    PolygonTessellator tessellator;
+    const GeometryCollection rectangle { { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 }, { 0, 0 } } };
+    EXPECT_EQ((std::vector<uint32_t>{ 0, 1, 2, 0, 2, 3 }), tessellator.tessellate(rectangle));
+}
+
+TEST(PolygonTessellator, Earcut) {
+    PolygonTessellator tessellator;
+
+    const GeometryCollection concave { { { 0, 0 }, { 10, 0 }, { 5, 5 }, { 10, 10 }, { 0, 10 }, { 0, 0 } } };
+    EXPECT_EQ(9u, tessellator.tessellate(concave).size());
+
+    const GeometryCollection withHole {
+        { { 0, 0 }, { 10, 0 }, { 10, 10 }, { 0, 10 }, { 0, 0 } },
+        { { 2, 2 }, { 2, 8 }, { 8, 8 }, { 8, 2 }, { 2, 2 } },
+    };
+    EXPECT_EQ(24u, tessellator.tessellate(withHole).size());
+
+    // The tessellator can be reused after releasing its buffers.
+    tessellator.clear();
+    EXPECT_EQ(9u, tessellator.tessellate(concave).size());
+}
@@ -6,6 +6,7 @@
 #include <mbgl/renderer/buckets/line_bucket.hpp>
 #include <mbgl/renderer/buckets/raster_bucket.hpp>
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
+#include <mbgl/renderer/buckets/bucket_serialization.hpp>
 #include <mbgl/renderer/bucket_parameters.hpp>
 #include <mbgl/style/layers/symbol_layer_properties.hpp>
 #include <mbgl/gl/context.hpp>
@@ -23,6 +24,11 @@ bool operator==(const Segment<Attributes>& lhs, const Segment<Attributes>& rhs)
 namespace gl {
 namespace detail {
 
+template <class A1>
+bool operator==(const Vertex<A1>& lhs, const Vertex<A1>& rhs) {
+    return lhs.a1 == rhs.a1;
+}
+
 template <class A1, class A2>
 bool operator==(const Vertex<A1, A2>& lhs, const Vertex<A1, A2>& rhs) {
     return std::tie(lhs.a1, lhs.a2) == std::tie(rhs.a1, rhs.a2);
@@ -71,6 +77,50 @@ TEST(Buckets, FillBucket) {
     ASSERT_FALSE(bucket.needsUpload());
 }
 
+TEST(Buckets, FillBucketSerialize) {
+    FillBucket bucket { { {0, 0, 0}, MapMode::Still, 1.0 }, {} };
+    GeometryCollection polygon { { { 0, 0 }, { 0, 1 }, { 1, 1 } }, { { 2, 2 }, { 2, 3 }, { 3, 3 } } };
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::Polygon, polygon, properties }, polygon);
+
+    optional<std::string> data = bucket.serialize();
+    ASSERT_TRUE(bool(data));
+
+    FillBucket restored { { {0, 0, 0}, MapMode::Still, 1.0 }, {} };
+    ASSERT_TRUE(restored.deserialize(*data));
+    EXPECT_EQ(bucket.vertices.vector(), restored.vertices.vector());
+    EXPECT_EQ(bucket.lines.vector(), restored.lines.vector());
+    EXPECT_EQ(bucket.triangles.vector(), restored.triangles.vector());
+    EXPECT_EQ(bucket.lineSegments, restored.lineSegments);
+    EXPECT_EQ(bucket.triangleSegments, restored.triangleSegments);
+    ASSERT_TRUE(restored.hasData());
+
+    // Segments that point past the end of the arrays are rejected.
+    std::string truncated;
+    protozero::pbf_writer pbf(truncated);
+    SegmentVector<FillAttributes> segments;
+    segments.emplace_back(0, 0, 3, 3);
+    writeBucketSegments(pbf, 5 /* triangle segments */, segments);
+    FillBucket invalid { { {0, 0, 0}, MapMode::Still, 1.0 }, {} };
+    EXPECT_THROW(invalid.deserialize(truncated), std::runtime_error);
+    EXPECT_FALSE(invalid.hasData());
+
+    // Indices that refer to vertices outside of their segment are rejected.
+    std::string corrupt;
+    protozero::pbf_writer corruptPbf(corrupt);
+    writeBucketArray(corruptPbf, 1 /* vertices */, bucket.vertices.vector());
+    writeBucketArray(corruptPbf, 3 /* triangles */, std::vector<uint16_t>{ 0, 1, 3 });
+    writeBucketSegments(corruptPbf, 5 /* triangle segments */, segments);
+    EXPECT_THROW(invalid.deserialize(corrupt), std::runtime_error);
+    EXPECT_FALSE(invalid.hasData());
+}
+
+TEST(Buckets, SerializationFormat) {
+    // The signature changes along with the vertex layout.
+    EXPECT_EQ("a_pos:4,4", bucketFormatSignature<FillLayoutAttributes>());
+    EXPECT_EQ("a_pos_normal:6,a_data:4,10", bucketFormatSignature<LineLayoutAttributes>());
+    EXPECT_NE(FillBucket::serializationFormat(), LineBucket::serializationFormat());
+}
+
 TEST(Buckets, LineBucket) {
     gl::Context context;
     LineBucket bucket { { {0, 0, 0}, MapMode::Still, 1.0 }, {}, {} };
@@ -91,6 +141,22 @@ TEST(Buckets, LineBucket) {
     ASSERT_FALSE(bucket.needsUpload());
 }
 
+TEST(Buckets, LineBucketSerialize) {
+    LineBucket bucket { { {0, 0, 0}, MapMode::Still, 1.0 }, {}, {} };
+    GeometryCollection line { { { 0, 0 }, { 1, 1 }, { 2, 0 } } };
+    bucket.addFeature(StubGeometryTileFeature { {}, FeatureType::LineString, line, properties }, line);
+
+    optional<std::string> data = bucket.serialize();
+    ASSERT_TRUE(bool(data));
+
+    LineBucket restored { { {0, 0, 0}, MapMode::Still, 1.0 }, {}, {} };
+    ASSERT_TRUE(restored.deserialize(*data));
+    EXPECT_EQ(bucket.vertices.vector(), restored.vertices.vector());
+    EXPECT_EQ(bucket.triangles.vector(), restored.triangles.vector());
+    EXPECT_EQ(bucket.segments, restored.segments);
+    ASSERT_TRUE(restored.hasData());
+}
+
 TEST(Buckets, SymbolBucket) {
     style::SymbolLayoutProperties::PossiblyEvaluated layout;
     bool sdfIcons = false;
@@ -131,6 +197,10 @@ TEST(Buckets, RasterBucket) {
     bucket.upload(context);
     ASSERT_FALSE(bucket.needsUpload());
 
+    // The decoded image is released once it lives in the texture.
+    ASSERT_FALSE(bucket.image);
+    ASSERT_TRUE(bucket.hasData());
+
     bucket.clear();
     ASSERT_TRUE(bucket.needsUpload());
 }
@@ -6,6 +6,7 @@
 #include <mbgl/map/map.hpp>
 #include <mbgl/gl/context.hpp>
 #include <mbgl/gl/headless_frontend.hpp>
+#include <mbgl/renderer/renderer.hpp>
 #include <mbgl/util/default_thread_pool.hpp>
 #include <mbgl/storage/network_status.hpp>
 #include <mbgl/storage/default_file_source.hpp>
@@ -431,6 +432,54 @@ TEST(Map, WithoutVAOExtension) {
     test::checkImage("test/fixtures/map/no_vao", test.frontend.render(test.map), 0.002);
 }
 
+TEST(Map, FrameStats) {
+    MapTest<DefaultFileSource> test { ":memory:", "test/fixtures/api/assets" };
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/water.json"));
+    test.frontend.render(test.map);
+
+    FrameStats first = test.frontend.getRenderer()->getFrameStats();
+    EXPECT_GT(first.drawCalls, 0u);
+    EXPECT_GT(first.programBinds, 0u);
+    EXPECT_LE(first.programBinds, first.drawCalls);
+    EXPECT_GT(first.vertices, 0u);
+    EXPECT_GT(first.indices, 0u);
+    EXPECT_GT(first.bufferBytes, 0u);
+    ASSERT_EQ(1u, first.tiles.count("mapbox"));
+    EXPECT_GT(first.tiles.at("mapbox"), 0u);
+
+    // Tile buffers are uploaded once; rendering the same view again only issues draw calls.
+    test.frontend.render(test.map);
+
+    FrameStats second = test.frontend.getRenderer()->getFrameStats();
+    EXPECT_EQ(first.drawCalls, second.drawCalls);
+    EXPECT_EQ(first.tiles, second.tiles);
+    EXPECT_LT(second.bufferBytes, first.bufferBytes);
+}
+
+TEST(Map, ScissorClipping) {
+    MapTest<DefaultFileSource> test { ":memory:", "test/fixtures/api/assets" };
+
+    test.map.getStyle().loadJSON(util::read_file("test/fixtures/api/water.json"));
+    test.frontend.render(test.map);
+
+    // Tiles don't overlap in a fully loaded, unpitched map, so they're clipped without stencil masks.
+    FrameStats flat = test.frontend.getRenderer()->getFrameStats();
+    ASSERT_GT(flat.tiles.at("mapbox"), 0u);
+    EXPECT_EQ(0u, flat.clippingMasks);
+
+    test.map.setBearing(90);
+    test.frontend.render(test.map);
+    EXPECT_EQ(0u, test.frontend.getRenderer()->getFrameStats().clippingMasks);
+
+    // Pitched tiles aren't rectangles on screen anymore.
+    test.map.setPitch(45);
+    test.frontend.render(test.map);
+
+    FrameStats pitched = test.frontend.getRenderer()->getFrameStats();
+    EXPECT_GT(pitched.clippingMasks, 0u);
+}
+
 TEST(Map, RemoveLayer) {
     MapTest<> test;
 
@@ -0,0 +1,34 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/renderer/paint_property_binder.hpp>
+
+using namespace mbgl;
+
+TEST(PaintPropertyBinder, NormalizedAttributeValue) {
+    using Opacity = attributes::a_opacity::Type;
+
+    EXPECT_EQ((std::array<uint16_t, 1> {{ 0 }}), attributeValue<Opacity>(0.0f));
+    EXPECT_EQ((std::array<uint16_t, 1> {{ 32768 }}), attributeValue<Opacity>(0.5f));
+    EXPECT_EQ((std::array<uint16_t, 1> {{ 65535 }}), attributeValue<Opacity>(1.0f));
+
+    // Values outside of 0..1 are clamped.
+    EXPECT_EQ((std::array<uint16_t, 1> {{ 0 }}), attributeValue<Opacity>(-1.0f));
+    EXPECT_EQ((std::array<uint16_t, 1> {{ 65535 }}), attributeValue<Opacity>(2.0f));
+}
+
+TEST(PaintPropertyBinder, ColorAttributeValue) {
+    using FillColor = attributes::a_fill_color::Type;
+
+    EXPECT_EQ((std::array<uint16_t, 2> {{ 255 * 256 + 0, 0 * 256 + 255 }}),
+              attributeValue<FillColor>(Color { 1.0f, 0.0f, 0.0f, 1.0f }));
+}
+
+TEST(PaintPropertyBinder, VertexSize) {
+    // Source functions store one value per vertex, composite functions two. Single opacities are
+    // padded to keep the vertex stride aligned to four bytes.
+    EXPECT_EQ(4u, sizeof(PaintAttributeVertex<attributes::a_color::Type>));
+    EXPECT_EQ(8u, sizeof(gl::detail::Vertex<ZoomInterpolatedAttributeType<attributes::a_color::Type>>));
+    EXPECT_EQ(4u, sizeof(PaintAttributeVertex<attributes::a_opacity::Type>));
+    EXPECT_EQ(4u, sizeof(PaintAttributeVertex<attributes::a_width::Type>));
+    EXPECT_EQ(4u, sizeof(gl::detail::Vertex<ZoomInterpolatedAttributeType<attributes::a_opacity::Type>>));
+}
@@ -0,0 +1,49 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/renderer/render_tile.hpp>
+#include <mbgl/util/constants.hpp>
+#include <mbgl/util/mat4.hpp>
+
+using namespace mbgl;
+
+namespace {
+
+// Returns a matrix that projects the tile to the given rectangle of a 100×100 framebuffer.
+mat4 tileMatrix(double x, double y, double width, double height) {
+    mat4 matrix;
+    matrix::identity(matrix);
+    matrix[0] = width / 50 / util::EXTENT;
+    matrix[5] = height / 50 / util::EXTENT;
+    matrix[12] = x / 50 - 1;
+    matrix[13] = y / 50 - 1;
+    return matrix;
+}
+
+} // namespace
+
+TEST(RenderTile, CullsTilesOutsideOfViewport) {
+    const Size size { 100, 100 };
+
+    EXPECT_FALSE(RenderTile::isCulled(tileMatrix(0, 0, 100, 100), size));
+    EXPECT_FALSE(RenderTile::isCulled(tileMatrix(-50, -50, 100, 100), size));
+    EXPECT_FALSE(RenderTile::isCulled(tileMatrix(90, 90, 100, 100), size));
+
+    EXPECT_TRUE(RenderTile::isCulled(tileMatrix(110, 0, 100, 100), size));
+    EXPECT_TRUE(RenderTile::isCulled(tileMatrix(0, -110, 100, 100), size));
+    EXPECT_TRUE(RenderTile::isCulled(tileMatrix(-200, 200, 100, 100), size));
+}
+
+TEST(RenderTile, CullsTilesWithoutPixelCenters) {
+    const Size size { 100, 100 };
+
+    // Smaller than a pixel, between pixel centers.
+    EXPECT_TRUE(RenderTile::isCulled(tileMatrix(10.1, 10.1, 0.3, 0.3), size));
+
+    // Smaller than a pixel, but covering a pixel center, as tiles near the horizon of pitched views
+    // can. Skipping them would leave gaps between the surrounding tiles.
+    EXPECT_FALSE(RenderTile::isCulled(tileMatrix(10.4, 10.4, 0.3, 0.3), size));
+
+    // Thinner than a pixel along one axis only.
+    EXPECT_TRUE(RenderTile::isCulled(tileMatrix(10.1, 10, 0.3, 20), size));
+    EXPECT_FALSE(RenderTile::isCulled(tileMatrix(10.3, 10, 0.3, 20), size));
+}
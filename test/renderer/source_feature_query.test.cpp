@@ -0,0 +1,55 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/stub_geometry_tile_feature.hpp>
+
+#include <mbgl/renderer/source_feature_query.hpp>
+#include <mbgl/tile/tile_id.hpp>
+
+#include <memory>
+
+using namespace mbgl;
+
+namespace {
+
+class StubGeometryTileLayer : public GeometryTileLayer {
+public:
+    std::size_t featureCount() const override {
+        return features.size();
+    }
+
+    std::unique_ptr<GeometryTileFeature> getFeature(std::size_t i) const override {
+        return std::make_unique<StubGeometryTileFeature>(features.at(i));
+    }
+
+    std::string getName() const override {
+        return "layer";
+    }
+
+    std::vector<StubGeometryTileFeature> features;
+};
+
+} // namespace
+
+TEST(SourceFeatureQuery, SameIDInOneTile) {
+    StubGeometryTileLayer layer;
+    layer.features.emplace_back(FeatureIdentifier(uint64_t(1)), FeatureType::Point,
+                                GeometryCollection { GeometryCoordinates { { 10, 10 } } }, PropertyMap {{ "part", std::string("a") }});
+    layer.features.emplace_back(FeatureIdentifier(uint64_t(1)), FeatureType::Point,
+                                GeometryCollection { GeometryCoordinates { { 20, 20 } } }, PropertyMap {{ "part", std::string("b") }});
+
+    SourceQueryOptions options;
+    SourceFeatureQuery query(options);
+
+    // Features of the same tile with the same ID are distinct features.
+    query.addLayer(layer, "layer", OverscaledTileID(1, 0, 0));
+    ASSERT_EQ(2u, query.result.size());
+    EXPECT_EQ(Value(std::string("a")), query.result[0].properties.at("part"));
+    EXPECT_EQ(Value(std::string("b")), query.result[1].properties.at("part"));
+
+    // The same features in a neighboring tile are parts of the features already found.
+    query.addLayer(layer, "layer", OverscaledTileID(1, 1, 0));
+    EXPECT_EQ(2u, query.result.size());
+
+    // Features with the same ID in another source layer are different features.
+    query.addLayer(layer, "other", OverscaledTileID(1, 1, 0));
+    EXPECT_EQ(4u, query.result.size());
+}
@@ -0,0 +1,164 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/fake_file_source.hpp>
+
+#include <mbgl/renderer/tile_pyramid.hpp>
+#include <mbgl/renderer/tile_parameters.hpp>
+#include <mbgl/renderer/render_tile.hpp>
+#include <mbgl/renderer/image_manager.hpp>
+#include <mbgl/tile/vector_tile.hpp>
+#include <mbgl/map/transform.hpp>
+#include <mbgl/style/style.hpp>
+#include <mbgl/annotation/annotation_manager.hpp>
+#include <mbgl/text/glyph_manager.hpp>
+#include <mbgl/util/default_thread_pool.hpp>
+#include <mbgl/util/run_loop.hpp>
+#include <mbgl/util/tileset.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <tuple>
+
+using namespace mbgl;
+
+class TilePyramidTest {
+public:
+    FakeFileSource fileSource;
+    Transform transform;
+    util::RunLoop loop;
+    ThreadPool threadPool { 1 };
+    style::Style style { loop, fileSource, 1 };
+    AnnotationManager annotationManager { style };
+    ImageManager imageManager;
+    GlyphManager glyphManager { fileSource };
+    Tileset tileset { { "https://example.com/{z}-{x}-{y}.vector.pbf" }, { 0, 22 }, "none" };
+
+    TileParameters tileParameters {
+        1.0,
+        MapDebugOptions(),
+        transform.getState(),
+        threadPool,
+        fileSource,
+        MapMode::Continuous,
+        annotationManager,
+        imageManager,
+        glyphManager,
+        0,
+        nullptr
+    };
+
+    TilePyramid pyramid;
+
+    void update(SourceType type = SourceType::Vector) {
+        pyramid.update({}, true, false, tileParameters, type, 512, { 0, 22 },
+                       [&](const OverscaledTileID& tileID) {
+            return std::make_unique<VectorTile>(tileID, "source", tileParameters, tileset);
+        });
+    }
+
+    // Tile URLs in the order their pending requests are served.
+    std::vector<std::string> requestOrder() const {
+        std::vector<const FakeFileSource::FakeFileRequest*> requests { fileSource.requests.begin(),
+                                                                      fileSource.requests.end() };
+        std::stable_sort(requests.begin(), requests.end(), [](const auto* a, const auto* b) {
+            return a->resource.priority > b->resource.priority;
+        });
+        std::vector<std::string> urls;
+        for (const auto* request : requests) {
+            urls.push_back(request->resource.url);
+        }
+        return urls;
+    }
+};
+
+TEST(TilePyramid, RequestPriority) {
+    TilePyramidTest test;
+    test.transform.resize({ 1024, 1024 });
+    test.transform.setLatLngZoom(LatLngBounds(CanonicalTileID(2, 1, 1)).center(), 2);
+    test.update();
+
+    std::vector<std::string> order = test.requestOrder();
+    ASSERT_EQ(9u, order.size());
+    EXPECT_EQ("https://example.com/2-1-1.vector.pbf", order.front());
+
+    // Tiles closer to the new center move ahead of the tiles that were requested first.
+    test.transform.setLatLngZoom(LatLngBounds(CanonicalTileID(2, 2, 2)).center(), 2);
+    test.update();
+
+    order = test.requestOrder();
+    ASSERT_FALSE(order.empty());
+    EXPECT_EQ("https://example.com/2-2-2.vector.pbf", order.front());
+    auto previousCenter = std::find(order.begin(), order.end(), "https://example.com/2-1-1.vector.pbf");
+    ASSERT_NE(order.end(), previousCenter);
+    EXPECT_LT(4, previousCenter - order.begin());
+}
+
+TEST(TilePyramid, LevelOfDetail) {
+    TilePyramidTest test;
+    test.transform.resize({ 512, 512 });
+    test.transform.setLatLng({ 37.7749, -122.4194 });
+    test.transform.setZoom(10);
+    test.transform.setPitch(60.0 * M_PI / 180.0);
+
+    auto hasLowerZoomTiles = [&] {
+        return std::any_of(test.pyramid.tiles.begin(), test.pyramid.tiles.end(), [](const auto& pair) {
+            return pair.first.canonical.z < 10;
+        });
+    };
+
+    // Distant raster tiles keep the ideal zoom level.
+    test.update(SourceType::Raster);
+    ASSERT_FALSE(test.pyramid.tiles.empty());
+    EXPECT_FALSE(hasLowerZoomTiles());
+
+    test.update(SourceType::Vector);
+    EXPECT_TRUE(hasLowerZoomTiles());
+}
+
+namespace {
+
+class RenderableTile : public Tile {
+public:
+    RenderableTile(const OverscaledTileID& id_) : Tile(id_) {
+        renderable = true;
+        loaded = true;
+    }
+
+    void setNecessity(Necessity) override {}
+    void cancel() override {}
+    void upload(gl::Context&) override {}
+    Bucket* getBucket(const style::Layer::Impl&) const override { return nullptr; }
+};
+
+} // namespace
+
+TEST(TilePyramid, RenderTileOrder) {
+    TilePyramidTest test;
+    test.transform.resize({ 1024, 1024 });
+    test.transform.setLatLngZoom({ 0, 0 }, 2);
+    test.pyramid.update({}, true, false, test.tileParameters, SourceType::Vector, 512, { 0, 22 },
+                        [](const OverscaledTileID& tileID) {
+        return std::make_unique<RenderableTile>(tileID);
+    });
+
+    const auto& tiles = test.pyramid.getRenderTiles();
+    ASSERT_LT(1u, tiles.size());
+    EXPECT_TRUE(std::is_sorted(tiles.begin(), tiles.end(), [](const RenderTile& a, const RenderTile& b) {
+        return a.id < b.id;
+    }));
+
+    // The order is computed once per update, and kept across calls.
+    EXPECT_EQ(&tiles, &test.pyramid.getRenderTiles());
+
+    // Without rotation, symbol tiles are drawn from top to bottom, then from left to right.
+    auto symbolTiles = test.pyramid.getSymbolSortedRenderTiles(0);
+    ASSERT_EQ(tiles.size(), symbolTiles.size());
+    EXPECT_TRUE(std::is_sorted(symbolTiles.begin(), symbolTiles.end(), [](const RenderTile& a, const RenderTile& b) {
+        return std::tie(a.id.canonical.y, a.id.canonical.x) < std::tie(b.id.canonical.y, b.id.canonical.x);
+    }));
+
+    // Turned upside down, they're drawn from bottom to top.
+    symbolTiles = test.pyramid.getSymbolSortedRenderTiles(float(M_PI));
+    ASSERT_EQ(tiles.size(), symbolTiles.size());
+    EXPECT_GT(symbolTiles.front().get().id.canonical.y, symbolTiles.back().get().id.canonical.y);
+}
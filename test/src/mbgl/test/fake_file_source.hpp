@@ -35,6 +35,10 @@ public:
         ~FakeFileRequest() override {
             list.erase(link);
         }
+
+        void setPriority(int32_t priority) override {
+            resource.priority = priority;
+        }
     };
 
     std::unique_ptr<AsyncRequest> request(const Resource& resource, Callback callback) override {
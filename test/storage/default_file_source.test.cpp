@@ -1,7 +1,9 @@
 #include <mbgl/actor/actor.hpp>
 #include <mbgl/test/util.hpp>
 #include <mbgl/storage/default_file_source.hpp>
+#include <mbgl/storage/offline_database.hpp>
 #include <mbgl/storage/resource_transform.hpp>
+#include <mbgl/util/io.hpp>
 #include <mbgl/util/run_loop.hpp>
 
 using namespace mbgl;
@@ -307,6 +309,43 @@ TEST(DefaultFileSource, OptionalExpired) {
     loop.run();
 }
 
+TEST(DefaultFileSource, TEST_REQUIRES_WRITE(OptionalFromDatabaseFile)) {
+    util::RunLoop loop;
+
+    const std::string path = "test/fixtures/storage/cache.db";
+    try {
+        util::deleteFile(path);
+    } catch (util::IOException&) {
+    }
+
+    const Resource optionalResource { Resource::Unknown, "http://127.0.0.1:3000/test", {}, Resource::Optional };
+
+    using namespace std::chrono_literals;
+
+    Response response;
+    response.data = std::make_shared<std::string>("Cached value");
+    response.expires = util::now() + 1h;
+
+    {
+        OfflineDatabase db(path);
+        db.put(optionalResource, response);
+    }
+
+    // Lookups in a database file are served by reader threads.
+    DefaultFileSource fs(path, ".");
+
+    std::unique_ptr<AsyncRequest> req;
+    req = fs.request(optionalResource, [&](Response res) {
+        req.reset();
+        EXPECT_EQ(nullptr, res.error);
+        ASSERT_TRUE(res.data.get());
+        EXPECT_EQ("Cached value", *res.data);
+        loop.stop();
+    });
+
+    loop.run();
+}
+
 TEST(DefaultFileSource, GetBaseURLAndAccessTokenWhilePaused) {
     util::RunLoop loop;
     DefaultFileSource fs(":memory:", ".");
@@ -202,3 +202,33 @@ TEST(HTTPFileSource, TEST_REQUIRES_SERVER(Load)) {
 
     loop.run();
 }
+
+TEST(HTTPFileSource, TEST_REQUIRES_SERVER(MaximumConnectionsPerHost)) {
+    util::RunLoop loop;
+    HTTPFileSource fs;
+
+    // Requests beyond the connection limit wait for a connection instead of failing.
+    fs.setMaximumConnectionsPerHost(1);
+
+    const int count = 5;
+    int completed = 0;
+    std::unique_ptr<AsyncRequest> reqs[count];
+
+    for (int i = 0; i < count; i++) {
+        reqs[i] = fs.request({ Resource::Unknown, "http://127.0.0.1:3000/delayed" }, [&, i](Response res) {
+            reqs[i].reset();
+            EXPECT_EQ(nullptr, res.error);
+            ASSERT_TRUE(res.data.get());
+            EXPECT_EQ("Response", *res.data);
+
+            if (++completed == count) {
+                loop.stop();
+            }
+        });
+    }
+
+    loop.run();
+
+    // Plain HTTP responses are never multiplexed.
+    EXPECT_EQ(0u, fs.multiplexedRequestLimit("http://127.0.0.1:3000/delayed"));
+}
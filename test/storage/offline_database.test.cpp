@@ -386,6 +386,78 @@ TEST(OfflineDatabase, TEST_REQUIRES_WRITE(ConcurrentUse)) {
     thread2.join();
 }
 
+TEST(OfflineDatabase, TEST_REQUIRES_WRITE(ReadOnlyAccess)) {
+    using namespace mbgl;
+
+    createDir("test/fixtures/offline_database");
+    deleteFile("test/fixtures/offline_database/offline.db");
+
+    OfflineDatabase writer("test/fixtures/offline_database/offline.db");
+    OfflineDatabase reader("test/fixtures/offline_database/offline.db",
+                           util::DEFAULT_MAX_CACHE_SIZE, OfflineDatabase::Access::ReadOnly);
+
+    Resource resource { Resource::Style, "http://example.com/" };
+    Response response;
+    response.data = std::make_shared<std::string>("first");
+    writer.put(resource, response);
+
+    auto result = reader.get(resource);
+    ASSERT_TRUE(result && result->data);
+    EXPECT_EQ("first", *result->data);
+
+    // The reader sees data committed after it was opened.
+    response.data = std::make_shared<std::string>("second");
+    writer.put(resource, response);
+
+    result = reader.get(resource);
+    ASSERT_TRUE(result && result->data);
+    EXPECT_EQ("second", *result->data);
+
+    EXPECT_THROW(reader.put(resource, response), mapbox::sqlite::Exception);
+}
+
+TEST(OfflineDatabase, TEST_REQUIRES_WRITE(DeferredAccessTimes)) {
+    using namespace mbgl;
+
+    createDir("test/fixtures/offline_database");
+    deleteFile("test/fixtures/offline_database/offline.db");
+
+    Resource resource { Resource::Style, "http://example.com/" };
+    Response response;
+    response.data = std::make_shared<std::string>("data");
+
+    auto accessed = [] {
+        mapbox::sqlite::Database db("test/fixtures/offline_database/offline.db", mapbox::sqlite::ReadOnly);
+        mapbox::sqlite::Statement stmt = db.prepare("SELECT accessed FROM resources");
+        EXPECT_TRUE(stmt.run());
+        return stmt.get<int64_t>(0);
+    };
+
+    {
+        OfflineDatabase db("test/fixtures/offline_database/offline.db");
+        db.put(resource, response);
+    }
+
+    {
+        mapbox::sqlite::Database db("test/fixtures/offline_database/offline.db", mapbox::sqlite::ReadWrite);
+        db.exec("UPDATE resources SET accessed = 0");
+    }
+
+    {
+        OfflineDatabase db("test/fixtures/offline_database/offline.db");
+        for (int i = 0; i < 10; i++) {
+            EXPECT_TRUE(bool(db.get(resource)));
+            db.markAccessed(resource);
+        }
+
+        // Hits are recorded in memory only.
+        EXPECT_EQ(0, accessed());
+    }
+
+    // Pending access times are written when the database is closed.
+    EXPECT_LT(0, accessed());
+}
+
 static std::shared_ptr<std::string> randomString(size_t size) {
     auto result = std::make_shared<std::string>(size, 0);
     std::mt19937 random;
@@ -415,7 +487,7 @@ TEST(OfflineDatabase, PutReturnsSize) {
     EXPECT_EQ(0u, db.put(Resource::style("http://example.com/noContent"), noContent).second);
 }
 
-TEST(OfflineDatabase, PutEvictsLeastRecentlyUsedResources) {
+TEST(OfflineDatabase, EvictsLeastRecentlyUsedResources) {
     using namespace mbgl;
 
     OfflineDatabase db(":memory:", 1024 * 100);
@@ -426,12 +498,93 @@ TEST(OfflineDatabase, PutEvictsLeastRecentlyUsedResources) {
     for (uint32_t i = 1; i <= 100; i++) {
         Resource resource = Resource::style("http://example.com/"s + util::toString(i));
         db.put(resource, response);
+        if (db.needsEviction()) {
+            db.evict();
+        }
+        EXPECT_FALSE(db.needsEviction()) << i;
         EXPECT_TRUE(bool(db.get(resource))) << i;
     }
 
     EXPECT_FALSE(bool(db.get(Resource::style("http://example.com/1"))));
 }
 
+TEST(OfflineDatabase, PutDoesNotEvict) {
+    using namespace mbgl;
+
+    OfflineDatabase db(":memory:", 1024 * 100);
+
+    Response response;
+    response.data = randomString(1024);
+
+    for (uint32_t i = 1; i <= 200; i++) {
+        db.put(Resource::style("http://example.com/"s + util::toString(i)), response);
+    }
+
+    EXPECT_TRUE(db.needsEviction());
+    EXPECT_TRUE(bool(db.get(Resource::style("http://example.com/1"))));
+
+    db.evict();
+    EXPECT_FALSE(db.needsEviction());
+    EXPECT_FALSE(bool(db.get(Resource::style("http://example.com/1"))));
+    EXPECT_TRUE(bool(db.get(Resource::style("http://example.com/200"))));
+}
+
+TEST(OfflineDatabase, EvictsInBatches) {
+    using namespace mbgl;
+
+    OfflineDatabase db(":memory:", 1024 * 1000);
+
+    Response response;
+    response.data = randomString(1024);
+
+    for (uint32_t i = 1; i <= 2500; i++) {
+        db.put(Resource::style("http://example.com/"s + util::toString(i)), response);
+    }
+
+    // Getting below the target size takes more than one batch; each batch is committed on its own.
+    EXPECT_TRUE(db.evictBatch());
+    EXPECT_TRUE(db.needsEviction());
+    EXPECT_FALSE(bool(db.get(Resource::style("http://example.com/1"))));
+
+    EXPECT_FALSE(db.evictBatch());
+    EXPECT_FALSE(db.needsEviction());
+    EXPECT_TRUE(bool(db.get(Resource::style("http://example.com/2500"))));
+
+    EXPECT_FALSE(db.evictBatch());
+}
+
+TEST(OfflineDatabase, EvictDoesNotRemoveRegionResources) {
+    using namespace mbgl;
+
+    OfflineDatabase db(":memory:", 1024 * 100);
+    OfflineRegionDefinition definition { "", LatLngBounds::world(), 0, INFINITY, 1.0 };
+    OfflineRegion region = db.createRegion(definition, OfflineRegionMetadata());
+
+    Response response;
+    response.data = randomString(1024);
+
+    // An ambient resource that a region picks up later is no longer evicted.
+    db.put(Resource::style("http://example.com/1"), response);
+    db.putRegionResource(region.getID(), Resource::style("http://example.com/1"), response);
+
+    for (uint32_t i = 2; i <= 200; i++) {
+        db.put(Resource::style("http://example.com/"s + util::toString(i)), response);
+    }
+
+    db.evict();
+    EXPECT_TRUE(bool(db.get(Resource::style("http://example.com/1"))));
+    EXPECT_FALSE(bool(db.get(Resource::style("http://example.com/2"))));
+
+    // Once the region is gone, it is evicted like any other ambient resource.
+    db.deleteRegion(std::move(region));
+    for (uint32_t i = 201; i <= 400; i++) {
+        db.put(Resource::style("http://example.com/"s + util::toString(i)), response);
+    }
+
+    db.evict();
+    EXPECT_FALSE(bool(db.get(Resource::style("http://example.com/1"))));
+}
+
 TEST(OfflineDatabase, PutRegionResourceDoesNotEvict) {
     using namespace mbgl;
 
@@ -661,7 +814,7 @@ TEST(OfflineDatabase, MigrateFromV2Schema) {
         }
     }
 
-    EXPECT_EQ(6, databaseUserVersion("test/fixtures/offline_database/migrated.db"));
+    EXPECT_EQ(8, databaseUserVersion("test/fixtures/offline_database/migrated.db"));
     EXPECT_LT(databasePageCount("test/fixtures/offline_database/migrated.db"),
               databasePageCount("test/fixtures/offline_database/v2.db"));
 }
@@ -682,7 +835,7 @@ TEST(OfflineDatabase, MigrateFromV3Schema) {
         }
     }
 
-    EXPECT_EQ(6, databaseUserVersion("test/fixtures/offline_database/migrated.db"));
+    EXPECT_EQ(8, databaseUserVersion("test/fixtures/offline_database/migrated.db"));
 }
 
 TEST(OfflineDatabase, MigrateFromV4Schema) {
@@ -701,12 +854,12 @@ TEST(OfflineDatabase, MigrateFromV4Schema) {
         }
     }
 
-    EXPECT_EQ(6, databaseUserVersion("test/fixtures/offline_database/migrated.db"));
+    EXPECT_EQ(8, databaseUserVersion("test/fixtures/offline_database/migrated.db"));
 
-    // Journal mode should be DELETE after migration to v5.
-    EXPECT_EQ("delete", databaseJournalMode("test/fixtures/offline_database/migrated.db"));
+    // Journal mode should be WAL after migration to v7.
+    EXPECT_EQ("wal", databaseJournalMode("test/fixtures/offline_database/migrated.db"));
 
-    // Synchronous setting should be FULL (2) after migration to v5.
+    // Synchronous setting should be FULL (2) after migration to v7.
     EXPECT_EQ(2, databaseSyncMode("test/fixtures/offline_database/migrated.db"));
 }
 
@@ -727,13 +880,13 @@ TEST(OfflineDatabase, MigrateFromV5Schema) {
         }
     }
 
-    EXPECT_EQ(6, databaseUserVersion("test/fixtures/offline_database/migrated.db"));
+    EXPECT_EQ(8, databaseUserVersion("test/fixtures/offline_database/migrated.db"));
 
     EXPECT_EQ((std::vector<std::string>{ "id", "url_template", "pixel_ratio", "z", "x", "y",
                                          "expires", "modified", "etag", "data", "compressed",
-                                         "accessed", "must_revalidate" }),
+                                         "accessed", "must_revalidate", "region_owned" }),
               databaseTableColumns("test/fixtures/offline_database/migrated.db", "tiles"));
     EXPECT_EQ((std::vector<std::string>{ "id", "url", "kind", "expires", "modified", "etag", "data",
-                                         "compressed", "accessed", "must_revalidate" }),
+                                         "compressed", "accessed", "must_revalidate", "region_owned" }),
               databaseTableColumns("test/fixtures/offline_database/migrated.db", "resources"));
 }
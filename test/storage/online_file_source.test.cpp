@@ -1,14 +1,19 @@
 #include <mbgl/test/util.hpp>
 #include <mbgl/storage/online_file_source.hpp>
 #include <mbgl/storage/network_status.hpp>
+#include <mbgl/storage/http_file_source.hpp>
 #include <mbgl/util/chrono.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/util/timer.hpp>
 #include <mbgl/util/constants.hpp>
+#include <mbgl/util/string.hpp>
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 using namespace mbgl;
+using namespace std::literals::string_literals;
 
 TEST(OnlineFileSource, Cancel) {
     util::RunLoop loop;
@@ -46,6 +51,89 @@ TEST(OnlineFileSource, TEST_REQUIRES_SERVER(CancelMultiple)) {
     loop.run();
 }
 
+TEST(OnlineFileSource, TEST_REQUIRES_SERVER(CoalesceConcurrentRequests)) {
+    util::RunLoop loop;
+    OnlineFileSource fs;
+
+    const Resource resource { Resource::Unknown, "http://127.0.0.1:3000/coalesced" };
+
+    // The server counts the requests it receives; all callbacks get the response to the first.
+    std::vector<std::unique_ptr<AsyncRequest>> requests;
+    int responses = 0;
+    for (int i = 0; i < 5; i++) {
+        requests.push_back(fs.request(resource, [&](Response res) {
+            EXPECT_EQ(nullptr, res.error);
+            ASSERT_TRUE(res.data.get());
+            EXPECT_EQ("Response 1", *res.data);
+            if (++responses == 4) {
+                loop.stop();
+            }
+        }));
+    }
+
+    // Cancelling one of the requests doesn't cancel the transfer the others share.
+    requests[2].reset();
+
+    loop.run();
+    EXPECT_EQ(4, responses);
+    requests.clear();
+
+    // Requests made after the transfer completed start a new one.
+    std::unique_ptr<AsyncRequest> req = fs.request(resource, [&](Response res) {
+        req.reset();
+        ASSERT_TRUE(res.data.get());
+        EXPECT_EQ("Response 2", *res.data);
+        loop.stop();
+    });
+
+    loop.run();
+}
+
+TEST(OnlineFileSource, TEST_REQUIRES_SERVER(PendingRequestOrder)) {
+    util::RunLoop loop;
+    OnlineFileSource fs;
+
+    // Occupy all connections with requests that never get a response.
+    std::vector<std::unique_ptr<AsyncRequest>> stale;
+    for (uint32_t i = 0; i < HTTPFileSource::maximumConcurrentRequests(); i++) {
+        stale.push_back(fs.request({ Resource::Unknown, "http://127.0.0.1:3000/stale/"s + util::toString(i) },
+                                   [&](Response) { ADD_FAILURE() << "Callback should not be called"; }));
+    }
+
+    std::vector<std::string> completed;
+    std::vector<std::unique_ptr<AsyncRequest>> requests;
+    auto request = [&] (Resource::Kind kind, Resource::Necessity necessity, const std::string& name) {
+        requests.push_back(fs.request({ kind, "http://127.0.0.1:3000/load/"s + name, {}, necessity },
+                                      [&, name](Response res) {
+            EXPECT_EQ(nullptr, res.error);
+            completed.push_back(name);
+            if (completed.size() == 4) {
+                loop.stop();
+            }
+        }));
+    };
+
+    util::Timer queueTimer;
+    queueTimer.start(Milliseconds(100), Duration::zero(), [&] {
+        request(Resource::Tile, Resource::Optional, "1");
+        request(Resource::Tile, Resource::Required, "2");
+        request(Resource::Tile, Resource::Required, "3");
+        request(Resource::Style, Resource::Required, "4");
+    });
+
+    // Once they are all queued, free a single connection, so that the queued requests are made
+    // one after the other.
+    util::Timer releaseTimer;
+    releaseTimer.start(Milliseconds(200), Duration::zero(), [&] {
+        requests[2]->setPriority(1);
+        stale.pop_back();
+    });
+
+    loop.run();
+
+    EXPECT_EQ((std::vector<std::string>{ "4", "3", "2", "1" }), completed);
+}
+
 TEST(OnlineFileSource, TEST_REQUIRES_SERVER(TemporaryError)) {
     util::RunLoop loop;
     OnlineFileSource fs;
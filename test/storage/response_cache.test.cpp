@@ -0,0 +1,95 @@
+#include <mbgl/storage/response_cache.hpp>
+#include <mbgl/storage/resource.hpp>
+#include <mbgl/storage/response.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace mbgl;
+
+namespace {
+
+Response makeResponse(std::size_t size) {
+    Response response;
+    response.data = std::make_shared<std::string>(size, 'x');
+    return response;
+}
+
+} // namespace
+
+TEST(ResponseCache, HitsAndMisses) {
+    ResponseCache cache(1024 * 1024);
+    const Resource resource = Resource::style("http://example.com/style.json");
+    const Response response = makeResponse(10);
+
+    EXPECT_FALSE(bool(cache.get(resource)));
+    cache.put(resource, response);
+
+    auto result = cache.get(resource);
+    ASSERT_TRUE(bool(result));
+    // The data is shared, not copied.
+    EXPECT_EQ(response.data, result->data);
+
+    EXPECT_EQ(1u, cache.hits());
+    EXPECT_EQ(1u, cache.misses());
+
+    cache.remove(resource);
+    EXPECT_FALSE(bool(cache.get(resource)));
+    EXPECT_EQ(2u, cache.misses());
+}
+
+TEST(ResponseCache, Expiration) {
+    ResponseCache cache(1024 * 1024);
+    const Resource resource = Resource::style("http://example.com/style.json");
+
+    Response fresh = makeResponse(10);
+    fresh.mustRevalidate = true;
+    fresh.expires = util::now() + Seconds(60);
+    cache.put(resource, fresh);
+    EXPECT_TRUE(bool(cache.get(resource)));
+
+    // Stale responses aren't kept, and replace the previous response.
+    Response stale = makeResponse(10);
+    stale.mustRevalidate = true;
+    stale.expires = util::now() - Seconds(60);
+    cache.put(resource, stale);
+    EXPECT_FALSE(bool(cache.get(resource)));
+
+    // Neither are errors or 304 Not Modified responses, which carry no data.
+    cache.put(resource, fresh);
+    Response notModified;
+    notModified.notModified = true;
+    cache.put(resource, notModified);
+    EXPECT_FALSE(bool(cache.get(resource)));
+
+    Response error;
+    error.error = std::make_unique<Response::Error>(Response::Error::Reason::Server);
+    cache.put(resource, error);
+    EXPECT_FALSE(bool(cache.get(resource)));
+}
+
+TEST(ResponseCache, EvictsLeastRecentlyUsed) {
+    ResponseCache cache(64 * 1024);
+
+    auto tile = [] (int32_t x) {
+        return Resource::tile("http://example.com/{z}/{x}/{y}.pbf", 1, x, 0, 16, Tileset::Scheme::XYZ);
+    };
+
+    for (int32_t x = 0; x < 100; x++) {
+        cache.put(tile(x), makeResponse(1024));
+        // Keep the first tile in use.
+        EXPECT_TRUE(bool(cache.get(tile(0))));
+    }
+
+    EXPECT_TRUE(bool(cache.get(tile(0))));
+    EXPECT_TRUE(bool(cache.get(tile(99))));
+
+    std::size_t cached = 0;
+    for (int32_t x = 0; x < 100; x++) {
+        cached += bool(cache.get(tile(x)));
+    }
+    EXPECT_LT(cached, 64u);
+
+    // Responses larger than a shard are not cached at all.
+    cache.put(tile(100), makeResponse(64 * 1024));
+    EXPECT_FALSE(bool(cache.get(tile(100))));
+}
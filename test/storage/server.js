@@ -164,6 +164,13 @@ app.get('/delayed', function(req, res) {
     }, 200);
 });
 
+var coalescedCounter = 0;
+app.get('/coalesced', function(req, res) {
+    var counter = ++coalescedCounter;
+    setTimeout(function() {
+        res.status(200).send('Response ' + counter);
+    }, 200);
+});
 
 app.get('/load/:number(\\d+)', function(req, res) {
     res.send('Request ' + req.params.number);
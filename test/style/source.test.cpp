@@ -63,7 +63,8 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        nullptr
     };
 
     SourceTest() {
@@ -99,3 +99,97 @@ TEST(Style, RemoveSourceInUse) {
 
     EXPECT_EQ(log->count(logMessage), 1u);
 }
+
+TEST(Style, DeferredLayerParsing) {
+    util::RunLoop loop;
+
+    ThreadPool threadPool{ 1 };
+    StubFileSource fileSource;
+    Style::Impl style { threadPool, fileSource, 1.0 };
+    style.deferLayerParsing = true;
+
+    style.loadJSON(R"STYLE({
+        "sources": { "vector": { "type": "vector", "tiles": [ "http://example.com/{z}/{x}/{y}.pbf" ] } },
+        "layers": [{
+            "id": "road",
+            "type": "line",
+            "source": "vector",
+            "source-layer": "road",
+            "minzoom": 14,
+            "layout": { "line-cap": "round" }
+        }, {
+            "id": "water",
+            "type": "line",
+            "source": "vector",
+            "source-layer": "water",
+            "layout": { "line-cap": "round" }
+        }]
+    })STYLE");
+
+    // Layers without a zoom range are converted right away.
+    Layer* water = style.getLayer("water");
+    ASSERT_TRUE(water);
+    EXPECT_EQ(VisibilityType::Visible, water->getVisibility());
+    EXPECT_EQ(LineCapType::Round, water->as<LineLayer>()->getLineCap().asConstant());
+
+    // Deferred layers keep their place in the style, but are hidden until converted. Looking them
+    // up doesn't convert them.
+    Layer* road = style.getLayer("road");
+    ASSERT_TRUE(road);
+    EXPECT_NE(nullptr, road->deferredJSON);
+    EXPECT_EQ(14, road->getMinZoom());
+    EXPECT_EQ(2u, style.getLayers().size());
+    EXPECT_NE(nullptr, road->deferredJSON);
+
+    style.parseDeferredLayers(10);
+    EXPECT_NE(nullptr, road->deferredJSON);
+
+    // Layers are converted in place, so pointers to them remain valid.
+    style.parseDeferredLayers(13.5);
+    EXPECT_EQ(nullptr, road->deferredJSON);
+    EXPECT_EQ(road, style.getLayer("road"));
+    EXPECT_EQ(VisibilityType::Visible, road->getVisibility());
+    EXPECT_EQ(LineCapType::Round, road->as<LineLayer>()->getLineCap().asConstant());
+    EXPECT_EQ("road", style.getLayers().front()->getID());
+}
+
+TEST(Style, DeferredLayerParsingOnAccess) {
+    util::RunLoop loop;
+
+    ThreadPool threadPool{ 1 };
+    StubFileSource fileSource;
+    Style::Impl style { threadPool, fileSource, 1.0 };
+    style.deferLayerParsing = true;
+
+    style.loadJSON(R"STYLE({
+        "sources": { "vector": { "type": "vector", "tiles": [ "http://example.com/{z}/{x}/{y}.pbf" ] } },
+        "layers": [{
+            "id": "road",
+            "type": "line",
+            "source": "vector",
+            "source-layer": "road",
+            "minzoom": 14,
+            "layout": { "line-cap": "round" }
+        }, {
+            "id": "rail",
+            "type": "line",
+            "source": "vector",
+            "source-layer": "rail",
+            "minzoom": 14,
+            "layout": { "line-cap": "round" }
+        }]
+    })STYLE");
+
+    // Accessing a property converts the layer first.
+    Layer* road = style.getLayer("road");
+    EXPECT_EQ(LineCapType::Round, road->as<LineLayer>()->getLineCap().asConstant());
+    EXPECT_EQ(nullptr, road->deferredJSON);
+
+    // Properties set before the layer is converted aren't overwritten by the conversion.
+    Layer* rail = style.getLayer("rail");
+    rail->as<LineLayer>()->setLineCap(LineCapType::Square);
+    EXPECT_EQ(nullptr, rail->deferredJSON);
+    style.parseDeferredLayers(14);
+    EXPECT_EQ(LineCapType::Square, rail->as<LineLayer>()->getLineCap().asConstant());
+    EXPECT_EQ(VisibilityType::Visible, rail->getVisibility());
+}
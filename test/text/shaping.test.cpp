@@ -0,0 +1,60 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/text/bidi.hpp>
+#include <mbgl/text/glyph.hpp>
+#include <mbgl/text/shaping.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+Glyphs makeGlyphs(const std::u16string& chars) {
+    Glyphs glyphs;
+    for (char16_t chr : chars) {
+        Glyph glyph;
+        glyph.id = chr;
+        glyph.metrics.advance = 10;
+        glyphs.emplace(chr, makeMutable<Glyph>(std::move(glyph)));
+    }
+    return glyphs;
+}
+
+} // namespace
+
+TEST(Shaping, LineBreaks) {
+    const std::u16string text = u"Washington Square Park North";
+    const Glyphs glyphs = makeGlyphs(text);
+    ShapingBuffers buffers;
+
+    determineLineBreaks(text, 0, 120, WritingModeType::Horizontal, glyphs, buffers);
+    EXPECT_EQ((std::vector<std::size_t>{ 11, 23, 28 }), buffers.lineBreaks);
+
+    // Buffers are reset for every label.
+    determineLineBreaks(text, 0, 0, WritingModeType::Horizontal, glyphs, buffers);
+    EXPECT_TRUE(buffers.lineBreaks.empty());
+    determineLineBreaks(text, 0, 120, WritingModeType::Vertical, glyphs, buffers);
+    EXPECT_TRUE(buffers.lineBreaks.empty());
+}
+
+TEST(Shaping, ReusesBuffers) {
+    const Glyphs glyphs = makeGlyphs(u"Washington Square Park North");
+    BiDi bidi;
+    ShapingBuffers buffers;
+
+    auto shape = [&] (const std::u16string& text) {
+        return getShaping(text, 120, 24, TextAnchorType::Center, TextJustifyType::Center, 0,
+                          { 0, 0 }, 24, WritingModeType::Horizontal, bidi, buffers, glyphs);
+    };
+
+    Shaping wrapped = shape(u"Washington Square Park North");
+    EXPECT_EQ(3u, buffers.lines.size());
+    EXPECT_EQ(u"Washington ", buffers.lines[0]);
+    EXPECT_EQ(u"Square Park ", buffers.lines[1]);
+    EXPECT_EQ(u"North", buffers.lines[2]);
+    EXPECT_EQ(26u, wrapped.positionedGlyphs.size());
+
+    Shaping single = shape(u"Park");
+    EXPECT_EQ(1u, buffers.lines.size());
+    EXPECT_EQ(u"Park", buffers.lines[0]);
+    EXPECT_EQ(4u, single.positionedGlyphs.size());
+}
@@ -0,0 +1,92 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/text/bidi.hpp>
+#include <mbgl/text/glyph.hpp>
+#include <mbgl/text/shaping_cache.hpp>
+
+using namespace mbgl;
+using namespace mbgl::style;
+
+namespace {
+
+Glyphs makeGlyphs(const std::u16string& chars) {
+    Glyphs glyphs;
+    for (char16_t chr : chars) {
+        Glyph glyph;
+        glyph.id = chr;
+        glyph.metrics.advance = 10;
+        glyphs.emplace(chr, makeMutable<Glyph>(std::move(glyph)));
+    }
+    return glyphs;
+}
+
+Shaping shape(ShapingCache& cache, const std::u16string& text, const FontStack& fontStack,
+              float maxWidth, BiDi& bidi, const Glyphs& glyphs) {
+    ShapingBuffers buffers;
+    return cache.get(text, fontStack, maxWidth, 24, TextAnchorType::Center, TextJustifyType::Center,
+                     0, { 0, 0 }, 24, WritingModeType::Horizontal, bidi, buffers, glyphs);
+}
+
+} // namespace
+
+TEST(ShapingCache, Hit) {
+    BiDi bidi;
+    ShapingCache cache;
+    const Glyphs glyphs = makeGlyphs(u"Main Street");
+    const FontStack fontStack { "Open Sans Regular" };
+
+    Shaping first = shape(cache, u"Main Street", fontStack, 240, bidi, glyphs);
+    EXPECT_EQ(0u, cache.hits());
+    EXPECT_EQ(1u, cache.misses());
+
+    Shaping second = shape(cache, u"Main Street", fontStack, 240, bidi, glyphs);
+    EXPECT_EQ(1u, cache.hits());
+    EXPECT_EQ(1u, cache.misses());
+    EXPECT_EQ(1u, cache.size());
+
+    ASSERT_EQ(first.positionedGlyphs.size(), second.positionedGlyphs.size());
+    for (std::size_t i = 0; i < first.positionedGlyphs.size(); i++) {
+        EXPECT_EQ(first.positionedGlyphs[i].glyph, second.positionedGlyphs[i].glyph);
+        EXPECT_EQ(first.positionedGlyphs[i].x, second.positionedGlyphs[i].x);
+        EXPECT_EQ(first.positionedGlyphs[i].y, second.positionedGlyphs[i].y);
+    }
+    EXPECT_EQ(first.top, second.top);
+    EXPECT_EQ(first.left, second.left);
+}
+
+TEST(ShapingCache, KeyedByParameters) {
+    BiDi bidi;
+    ShapingCache cache;
+    const Glyphs glyphs = makeGlyphs(u"Main Street");
+
+    shape(cache, u"Main Street", { "Open Sans Regular" }, 240, bidi, glyphs);
+    shape(cache, u"Main Street", { "Open Sans Bold" }, 240, bidi, glyphs);
+    shape(cache, u"Main Street", { "Open Sans Regular" }, 48, bidi, glyphs);
+    EXPECT_EQ(0u, cache.hits());
+    EXPECT_EQ(3u, cache.misses());
+
+    // Shaping again once more glyphs are available.
+    shape(cache, u"Main Street", { "Open Sans Regular" }, 240, bidi, makeGlyphs(u"Main"));
+    EXPECT_EQ(0u, cache.hits());
+    EXPECT_EQ(4u, cache.misses());
+}
+
+TEST(ShapingCache, EvictsLeastRecentlyUsed) {
+    BiDi bidi;
+    ShapingCache cache { 2 };
+    const Glyphs glyphs = makeGlyphs(u"ABC");
+    const FontStack fontStack { "Open Sans Regular" };
+
+    shape(cache, u"A", fontStack, 240, bidi, glyphs);
+    shape(cache, u"B", fontStack, 240, bidi, glyphs);
+    shape(cache, u"A", fontStack, 240, bidi, glyphs);
+    shape(cache, u"C", fontStack, 240, bidi, glyphs);
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_EQ(1u, cache.hits());
+
+    // "B" was evicted, "A" was kept.
+    shape(cache, u"A", fontStack, 240, bidi, glyphs);
+    EXPECT_EQ(2u, cache.hits());
+    shape(cache, u"B", fontStack, 240, bidi, glyphs);
+    EXPECT_EQ(2u, cache.hits());
+    EXPECT_EQ(4u, cache.misses());
+}
@@ -45,7 +45,8 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        nullptr
     };
 };
 
@@ -93,7 +94,10 @@ TEST(AnnotationTile, Issue8289) {
     TransformState transformState;
     RenderedQueryOptions options;
 
-    tile.queryRenderedFeatures(result, queryGeometry, transformState, test.renderStyle, options);
+    tile.queryRenderedFeatures([&] (const std::string& layerID, Feature&& feature) {
+        result[layerID].push_back(std::move(feature));
+        return true;
+    }, queryGeometry, transformState, test.renderStyle, options);
 
     EXPECT_TRUE(result.empty());
 }
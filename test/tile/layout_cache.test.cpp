@@ -0,0 +1,90 @@
+#include <mbgl/test/util.hpp>
+#include <mbgl/test/fixture_log_observer.hpp>
+
+#include <mbgl/tile/layout_cache.hpp>
+#include <mbgl/util/io.hpp>
+
+#include <dirent.h>
+
+using namespace mbgl;
+
+namespace {
+
+const std::string cacheDirectory = cacheDirectory;
+
+// Deletes the entries and the index left behind by earlier tests and runs, so that they don't
+// affect the use order and size of the cache.
+void clearCacheDirectory() {
+    const std::string prefix = "com.mapbox.gl.layout.";
+    DIR *dir = opendir(cacheDirectory.c_str());
+    ASSERT_NE(nullptr, dir);
+    for (dirent *dp = nullptr; (dp = readdir(dir)) != nullptr;) {
+        const std::string name = dp->d_name;
+        if (name.compare(0, prefix.length(), prefix) == 0) {
+            util::deleteFile(cacheDirectory + "/" + name);
+        }
+    }
+    closedir(dir);
+}
+
+} // namespace
+
+TEST(LayoutCache, PutAndGet) {
+    clearCacheDirectory();
+    LayoutCache cache { cacheDirectory };
+
+    LayoutCache::Buckets buckets {
+        { "fill", std::string("\0\1\2\3", 4) },
+        { "line", "" },
+    };
+    cache.put("1/14/12345:678", buckets);
+
+    EXPECT_EQ(buckets, cache.get("1/14/12345:678"));
+    EXPECT_TRUE(cache.get("1/15/12345:678").empty());
+
+    // Replaces the existing entry.
+    cache.put("1/14/12345:678", {});
+    EXPECT_TRUE(cache.get("1/14/12345:678").empty());
+}
+
+TEST(LayoutCache, InvalidDirectory) {
+    FixtureLog log;
+    LayoutCache cache { cacheDirectory + "/missing" };
+
+    cache.put("1/14/12345:678", { { "fill", "data" } });
+    EXPECT_FALSE(log.empty());
+    EXPECT_TRUE(cache.get("1/14/12345:678").empty());
+}
+
+TEST(LayoutCache, EvictLeastRecentlyUsed) {
+    clearCacheDirectory();
+    const std::string data(100, 'x');
+    LayoutCache cache { cacheDirectory, 300 };
+
+    cache.put("evict/a", { { "fill", data } });
+    cache.put("evict/b", { { "fill", data } });
+    EXPECT_FALSE(cache.get("evict/a").empty());
+
+    // Exceeds the maximum size and deletes the least recently used entry.
+    cache.put("evict/c", { { "fill", data } });
+    EXPECT_LE(cache.size(), 300u);
+    EXPECT_FALSE(cache.get("evict/a").empty());
+    EXPECT_TRUE(cache.get("evict/b").empty());
+    EXPECT_FALSE(cache.get("evict/c").empty());
+}
+
+TEST(LayoutCache, IndexPersistsAcrossInstances) {
+    clearCacheDirectory();
+    const std::string data(100, 'x');
+    uint64_t size = 0;
+    {
+        LayoutCache cache { cacheDirectory, 300 };
+        cache.put("persist/a", { { "fill", data } });
+        size = cache.size();
+    }
+
+    // The index is saved when the cache is destroyed, and records the size of the entries.
+    LayoutCache reopened { cacheDirectory, 300 };
+    EXPECT_EQ(size, reopened.size());
+    EXPECT_FALSE(reopened.get("persist/a").empty());
+}
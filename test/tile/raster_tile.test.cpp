@@ -1,9 +1,12 @@
 #include <mbgl/test/util.hpp>
 #include <mbgl/test/fake_file_source.hpp>
+#include <mbgl/test/stub_tile_observer.hpp>
 #include <mbgl/tile/raster_tile.hpp>
 #include <mbgl/tile/tile_loader_impl.hpp>
 
 #include <mbgl/style/style.hpp>
+#include <mbgl/style/layers/raster_layer.hpp>
+#include <mbgl/util/io.hpp>
 #include <mbgl/util/default_thread_pool.hpp>
 #include <mbgl/util/run_loop.hpp>
 #include <mbgl/map/transform.hpp>
@@ -37,13 +40,14 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        nullptr
     };
 };
 
 TEST(RasterTile, setError) {
     RasterTileTest test;
-    RasterTile tile(OverscaledTileID(0, 0, 0), test.tileParameters, test.tileset);
+    RasterTile tile(OverscaledTileID(0, 0, 0), test.tileParameters, test.tileset, 512);
     tile.setError(std::make_exception_ptr(std::runtime_error("test")));
     EXPECT_FALSE(tile.isRenderable());
     EXPECT_TRUE(tile.isLoaded());
@@ -52,7 +56,7 @@ TEST(RasterTile, setError) {
 
 TEST(RasterTile, onError) {
     RasterTileTest test;
-    RasterTile tile(OverscaledTileID(0, 0, 0), test.tileParameters, test.tileset);
+    RasterTile tile(OverscaledTileID(0, 0, 0), test.tileParameters, test.tileset, 512);
     tile.onError(std::make_exception_ptr(std::runtime_error("test")));
     EXPECT_FALSE(tile.isRenderable());
     EXPECT_TRUE(tile.isLoaded());
@@ -61,7 +65,7 @@ TEST(RasterTile, onError) {
 
 TEST(RasterTile, onParsed) {
     RasterTileTest test;
-    RasterTile tile(OverscaledTileID(0, 0, 0), test.tileParameters, test.tileset);
+    RasterTile tile(OverscaledTileID(0, 0, 0), test.tileParameters, test.tileset, 512);
     tile.onParsed(std::make_unique<RasterBucket>(PremultipliedImage{}));
     EXPECT_TRUE(tile.isRenderable());
     EXPECT_TRUE(tile.isLoaded());
@@ -70,9 +74,65 @@ TEST(RasterTile, onParsed) {
 
 TEST(RasterTile, onParsedEmpty) {
     RasterTileTest test;
-    RasterTile tile(OverscaledTileID(0, 0, 0), test.tileParameters, test.tileset);
+    RasterTile tile(OverscaledTileID(0, 0, 0), test.tileParameters, test.tileset, 512);
     tile.onParsed(nullptr);
     EXPECT_FALSE(tile.isRenderable());
     EXPECT_TRUE(tile.isLoaded());
     EXPECT_TRUE(tile.isComplete());
 }
+
+TEST(RasterTile, CompactAndRevive) {
+    RasterTileTest test;
+    style::RasterLayer layer("raster", "source");
+    RasterTile tile(OverscaledTileID(0, 0, 0), test.tileParameters, test.tileset, 512);
+
+    StubTileObserver observer;
+    tile.setObserver(&observer);
+
+    tile.setData(std::make_shared<std::string>(util::read_file("test/fixtures/image/tile.png")), {}, {});
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+    EXPECT_TRUE(tile.isRenderable());
+    EXPECT_NE(nullptr, tile.getBucket(*layer.baseImpl));
+
+    // Cached tiles only retain the encoded image.
+    tile.compact();
+    EXPECT_TRUE(tile.isRenderable());
+    EXPECT_EQ(nullptr, tile.getBucket(*layer.baseImpl));
+
+    // Reviving the tile decodes the image again on the worker.
+    tile.revive();
+    EXPECT_FALSE(tile.isRenderable());
+    EXPECT_FALSE(tile.isComplete());
+    while (!tile.isComplete()) {
+        test.loop.runOnce();
+    }
+    EXPECT_TRUE(tile.isRenderable());
+    EXPECT_NE(nullptr, tile.getBucket(*layer.baseImpl));
+}
+
+#if !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
+TEST(RasterTile, DecodeSize) {
+    RasterTileTest test;
+    style::RasterLayer layer("raster", "source");
+
+    auto decode = [&] (const Tileset& tileset) {
+        RasterTile tile(OverscaledTileID(0, 0, 0), test.tileParameters, tileset, 64);
+        tile.setData(std::make_shared<std::string>(util::read_file("test/fixtures/image/tile.jpeg")), {}, {});
+        while (!tile.isComplete()) {
+            test.loop.runOnce();
+        }
+        auto bucket = static_cast<RasterBucket*>(tile.getBucket(*layer.baseImpl));
+        EXPECT_NE(nullptr, bucket);
+        return bucket ? bucket->image->size : Size {};
+    };
+
+    // The 256px image is scaled down to the size the tile is displayed at.
+    EXPECT_EQ((Size { 64, 64 }), decode(test.tileset));
+
+    // Tiles of the maximum zoom level keep their full resolution, since they are magnified when
+    // zooming in further.
+    EXPECT_EQ((Size { 256, 256 }), decode(Tileset { { "https://example.com" }, { 0, 0 }, "none" }));
+}
+#endif
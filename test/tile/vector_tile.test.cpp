@@ -11,6 +11,7 @@
 #include <mbgl/renderer/tile_parameters.hpp>
 #include <mbgl/renderer/buckets/symbol_bucket.hpp>
 #include <mbgl/renderer/query.hpp>
+#include <mbgl/renderer/source_feature_query.hpp>
 #include <mbgl/text/collision_tile.hpp>
 #include <mbgl/geometry/feature_index.hpp>
 #include <mbgl/annotation/annotation_manager.hpp>
@@ -43,7 +44,8 @@ public:
         annotationManager,
         imageManager,
         glyphManager,
-        0
+        0,
+        nullptr
     };
 };
 
@@ -105,6 +107,7 @@ TEST(VectorTile, Issue8542) {
     VectorTile tile(OverscaledTileID(0, 0, 0), "source", test.tileParameters, test.tileset);
 
     // Query before data is set
-    std::vector<Feature> result;
-    tile.querySourceFeatures(result, { { {"layer"} }, {} });
+    SourceQueryOptions options { { {"layer"} }, {} };
+    SourceFeatureQuery query(options);
+    tile.querySourceFeatures(query);
 }
@@ -0,0 +1,11 @@
+#include <mbgl/test/util.hpp>
+
+#include <mbgl/util/fnv_hash.hpp>
+
+using namespace mbgl;
+
+TEST(FNVHash, ReferenceValues) {
+    EXPECT_EQ(0xcbf29ce484222325ull, util::fnvHash(""));
+    EXPECT_EQ(0xaf63dc4c8601ec8cull, util::fnvHash("a"));
+    EXPECT_EQ(0x85944171f73967e8ull, util::fnvHash("foobar"));
+}
@@ -2,6 +2,7 @@
 
 #include <mbgl/util/premultiply.hpp>
 #include <mbgl/util/image.hpp>
+#include <mbgl/util/image_decoder.hpp>
 #include <mbgl/util/io.hpp>
 
 using namespace mbgl;
@@ -86,6 +87,38 @@ TEST(Image, WebPTile) {
 }
 #endif // !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
 
+#if !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
+TEST(Image, DecodeIntoPooledBuffer) {
+    ImageBufferPool pool { 1024 * 1024 };
+    ImageDecodeOptions options;
+    options.pool = &pool;
+
+    const std::string data = util::read_file("test/fixtures/image/tile.png");
+    PremultipliedImage image = decodeImage(data, options);
+    EXPECT_EQ(256u, image.size.width);
+    EXPECT_EQ(256u, image.size.height);
+    EXPECT_EQ(decodeImage(data), image);
+
+    const uint8_t* buffer = image.data.get();
+    pool.recycle(std::move(image));
+    EXPECT_EQ(256u * 256u * 4u, pool.size());
+
+    PremultipliedImage reused = decodeImage(data, options);
+    EXPECT_EQ(buffer, reused.data.get());
+    EXPECT_EQ(0u, pool.size());
+}
+
+TEST(Image, DecodeScaledJPEG) {
+    ImageDecodeOptions options;
+    options.targetSize = Size { 100, 100 };
+
+    // DCT scaling only goes down to the closest size that still covers the target.
+    PremultipliedImage image = decodeImage(util::read_file("test/fixtures/image/tile.jpeg"), options);
+    EXPECT_EQ(128u, image.size.width);
+    EXPECT_EQ(128u, image.size.height);
+}
+#endif // !defined(__ANDROID__) && !defined(__APPLE__) && !defined(QT_IMAGE_DECODERS)
+
 TEST(Image, Resize) {
     AlphaImage image({0, 0});
 
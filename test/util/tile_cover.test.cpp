@@ -4,6 +4,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 using namespace mbgl;
 
 TEST(TileCover, Empty) {
@@ -42,6 +44,43 @@ TEST(TileCover, Pitch) {
               util::tileCover(transform.getState(), 2));
 }
 
+TEST(TileCover, LODUnpitched) {
+    Transform transform;
+    transform.resize({ 512, 512 });
+    transform.setLatLng({ 37.7749, -122.4194 });
+    transform.setZoom(10);
+
+    EXPECT_EQ(util::tileCover(transform.getState(), 10),
+              util::tileCoverWithLOD(transform.getState(), 10, 0));
+}
+
+TEST(TileCover, LODPitched) {
+    Transform transform;
+    transform.resize({ 512, 512 });
+    transform.setLatLng({ 37.7749, -122.4194 });
+    transform.setZoom(10);
+    transform.setPitch(60.0 * M_PI / 180.0);
+
+    const auto cover = util::tileCover(transform.getState(), 10);
+    const auto lod = util::tileCoverWithLOD(transform.getState(), 10, 0);
+
+    ASSERT_FALSE(lod.empty());
+    EXPECT_LT(lod.size(), cover.size());
+
+    // The tile closest to the center keeps the full zoom level, while far away tiles are replaced.
+    EXPECT_EQ(cover.front(), lod.front());
+    EXPECT_TRUE(std::any_of(lod.begin(), lod.end(), [](const UnwrappedTileID& id) {
+        return id.canonical.z < 10;
+    }));
+
+    // Every tile of the regular cover is covered by exactly one tile of the LOD cover.
+    for (const auto& tileID : cover) {
+        EXPECT_EQ(1, std::count_if(lod.begin(), lod.end(), [&](const UnwrappedTileID& id) {
+            return id == tileID || tileID.isChildOf(id);
+        })) << tileID;
+    }
+}
+
 TEST(TileCover, WorldZ1) {
     EXPECT_EQ((std::vector<UnwrappedTileID>{
                   { 1, 0, 0 }, { 1, 0, 1 }, { 1, 1, 0 }, { 1, 1, 1 },
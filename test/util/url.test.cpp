@@ -93,6 +93,16 @@ TEST(URL, Path) {
 
 auto URLPath = [](const char* str) { const URL url(str); return Path(str, url.path.first, url.path.second); };
 
+TEST(URL, Origin) {
+    EXPECT_EQ("http://example.com", origin("http://example.com/test?query=foo"));
+    EXPECT_EQ("http://127.0.0.1:8080", origin("http://127.0.0.1:8080/test?query=foo"));
+    EXPECT_EQ("https://[2a01:4f8:c17:3680::386a:6f3d]:8080", origin("https://[2a01:4f8:c17:3680::386a:6f3d]:8080/test"));
+    EXPECT_EQ("http://example.com", origin("http://example.com?query=foo"));
+    EXPECT_EQ("http://example.com", origin("http://example.com#bar"));
+    EXPECT_NE(origin("http://example.com/test"), origin("https://example.com/test"));
+    EXPECT_NE(origin("http://example.com/test"), origin("http://example.com:8080/test"));
+}
+
 TEST(Path, Directory) {
     EXPECT_EQ(Path::Segment({ 0, 8 }), Path("foo/bar/baz.ext").directory);
     EXPECT_EQ(Path::Segment({ 0, 8 }), Path("foo.bar/baz.ext").directory);